@@ -44,6 +44,8 @@ public class EasyDataTableEditor : ModuleRules
 				"ContentBrowser",
 				
 				"Json",
+				"JsonUtilities",
+				"DesktopPlatform",
 				"UnrealEd",
 				"ApplicationCore",
 				"BlueprintGraph",
@@ -3,13 +3,22 @@
 
 #include "EasyDataTableEditor.h"
 
+#include "Algo/Sort.h"
 #include "AssetRegistry/AssetData.h"
 #include "Containers/Map.h"
 #include "CoreGlobals.h"
 #include "EasyDataTableEditorModule.h"
+#include "EasyDataTableEditorStats.h"
 #include "DataTableUtils.h"
+#include "DesktopPlatformModule.h"
 #include "DetailsViewArgs.h"
+#include "EasyDataTableCellMeasurer.h"
+#include "EasyDataTableEditorModel.h"
+#include "EasyDataTableNumericColumn.h"
+#include "SEasyDataTableFacetPanel.h"
 #include "EasyDataTableEditorUtils.h"
+#include "EasyDataTableExporter.h"
+#include "EasyDataTableLayoutStore.h"
 #include "Dom/JsonObject.h"
 #include "Editor.h"
 #include "Editor/EditorEngine.h"
@@ -27,6 +36,7 @@
 #include "Framework/Notifications/NotificationManager.h"
 #include "Framework/Text/TextLayout.h"
 #include "Framework/Views/ITypedTableView.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "IDetailsView.h"
 #include "IDocumentation.h"
@@ -46,6 +56,7 @@
 #include "Policies/PrettyJsonPrintPolicy.h"
 #include "PropertyEditorModule.h"
 #include "Rendering/SlateRenderer.h"
+#include "SEasyDataTableLazyContent.h"
 #include "SEasyDataTableListViewRow.h"
 #include "SEasyRowEditor.h"
 #include "ScopedTransaction.h"
@@ -78,6 +89,7 @@
 #include "Widgets/Layout/SScrollBar.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Notifications/SNotificationList.h"
+#include "Widgets/Notifications/SProgressBar.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/SNullWidget.h"
 #include "Widgets/SToolTip.h"
@@ -96,6 +108,18 @@ const FName FEasyDataTableEditor::RowEditorTabId("DataTableEditor_RowEditor");
 const FName FEasyDataTableEditor::RowNameColumnId("RowName");
 const FName FEasyDataTableEditor::RowNumberColumnId("RowNumber");
 const FName FEasyDataTableEditor::RowDragDropColumnId("RowDragDrop");
+const FName FEasyDataTableEditor::RowModifiedColumnId("RowModified");
+
+static TAutoConsoleVariable<float> CVarReleaseHiddenTableAfterSeconds(
+	TEXT("EasyDataTableEditor.ReleaseHiddenTableAfterSeconds"),
+	300.0f,
+	TEXT("Seconds a table grid must stay hidden before its cached rows and row widgets are released. 0 disables releasing."));
+
+namespace EasyDataTableEditor
+{
+	/** How often hidden grids are checked against the release delay */
+	static constexpr float MemoryPolicyTickSeconds = 5.0f;
+}
 
 class SDataTableModeSeparator : public SBorder
 {
@@ -148,8 +172,6 @@ void FEasyDataTableEditor::UnregisterTabSpawners(const TSharedRef<class FTabMana
 
 void FEasyDataTableEditor::CreateAndRegisterDataTableTab(const TSharedRef<class FTabManager>& InTabManager)
 {
-	DataTableTabWidget = CreateContentBox();
-
 	InTabManager->RegisterTabSpawner(DataTableTabId, FOnSpawnTab::CreateSP(this, &FEasyDataTableEditor::SpawnTab_DataTable))
 		.SetDisplayName(LOCTEXT("DataTableTab", "Data Table"))
 		.SetGroup(WorkspaceMenuCategory.ToSharedRef());
@@ -157,12 +179,6 @@ void FEasyDataTableEditor::CreateAndRegisterDataTableTab(const TSharedRef<class
 
 void FEasyDataTableEditor::CreateAndRegisterDataTableDetailsTab(const TSharedRef<class FTabManager>& InTabManager)
 {
-	FPropertyEditorModule & EditModule = FModuleManager::Get().GetModuleChecked<FPropertyEditorModule>("PropertyEditor");
-	FDetailsViewArgs DetailsViewArgs;
-	DetailsViewArgs.NameAreaSettings = FDetailsViewArgs::HideNameArea;
-	DetailsViewArgs.bHideSelectionTip = true;
-	PropertyView = EditModule.CreateDetailView(DetailsViewArgs);
-
 	InTabManager->RegisterTabSpawner(DataTableDetailsTabId, FOnSpawnTab::CreateSP(this, &FEasyDataTableEditor::SpawnTab_DataTableDetails))
 		.SetDisplayName(LOCTEXT("DataTableDetailsTab", "Data Table Details"))
 		.SetGroup(WorkspaceMenuCategory.ToSharedRef());
@@ -170,18 +186,28 @@ void FEasyDataTableEditor::CreateAndRegisterDataTableDetailsTab(const TSharedRef
 
 void FEasyDataTableEditor::CreateAndRegisterRowEditorTab(const TSharedRef<class FTabManager>& InTabManager)
 {
-	RowEditorTabWidget = CreateRowEditorBox();
-
 	InTabManager->RegisterTabSpawner(RowEditorTabId, FOnSpawnTab::CreateSP(this, &FEasyDataTableEditor::SpawnTab_RowEditor))
 		.SetDisplayName(LOCTEXT("RowEditorTab", "Row Editor"))
 		.SetGroup(WorkspaceMenuCategory.ToSharedRef());
 }
 
 FEasyDataTableEditor::FEasyDataTableEditor()
-	: RowNameColumnWidth(0)
+	: bModelChangeDeferred(false)
+	, bDeferredRowsReassigned(false)
+	, bCachedDataReleased(false)
+	, HiddenSinceTime(0.0)
+	, ReleasedScrollOffset(0.0f)
+	, SelectionAnchorRowIndex(INDEX_NONE)
+	, PendingCellEditRow(nullptr)
+	, PendingCellEditColumnIndex(INDEX_NONE)
+	, RowNameColumnWidth(0)
 	, RowNumberColumnWidth(0)
 	, HighlightedVisibleRowIndex(INDEX_NONE)
 	, SortMode(EColumnSortMode::Ascending)
+	, bShowPerformanceStats(false)
+	, bShowFacetPanel(false)
+	, CachedNumGeneratedRowWidgets(INDEX_NONE)
+	, bPerformanceStatsTextDirty(true)
 {
 }
 
@@ -189,6 +215,16 @@ FEasyDataTableEditor::~FEasyDataTableEditor()
 {
 	GEditor->UnregisterForUndo(this);
 
+	if (MemoryPolicyTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(MemoryPolicyTickerHandle);
+	}
+
+	if (Model.IsValid())
+	{
+		Model->OnModelChanged().RemoveAll(this);
+	}
+
 	UDataTable* Table = GetEditableDataTable();
 	if (Table)
 	{
@@ -211,7 +247,7 @@ void FEasyDataTableEditor::HandleUndoRedo()
 	const UDataTable* Table = GetDataTable();
 	if (Table)
 	{
-		HandlePostChange();
+		// The shared model refreshes the cached rows
 		CallbackOnDataTableUndoRedo.ExecuteIfBound();
 	}
 }
@@ -222,11 +258,7 @@ void FEasyDataTableEditor::PreChange(const class UUserDefinedStruct* Struct, FSt
 
 void FEasyDataTableEditor::PostChange(const class UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info)
 {
-	const UDataTable* Table = GetDataTable();
-	if (Struct && Table && (Table->GetRowStruct() == Struct))
-	{
-		HandlePostChange();
-	}
+	// Handled by the shared model, see HandleModelChanged
 }
 
 void FEasyDataTableEditor::SelectionChange(const UDataTable* Changed, FName RowName)
@@ -237,6 +269,21 @@ void FEasyDataTableEditor::SelectionChange(const UDataTable* Changed, FName RowN
 		const bool bSelectionChanged = HighlightedRowName != RowName;
 		SetHighlightedRow(RowName);
 
+		// Selecting a row from code collapses the multi-row selection onto it
+		if (bSelectionChanged && VisibleRows.IsValidIndex(HighlightedVisibleRowIndex))
+		{
+			SelectionAnchorRowIndex = VisibleRows[HighlightedVisibleRowIndex]->CellIndex;
+			SelectedRowMask.Init(false, AvailableRows.Num());
+			SelectedRowMask[SelectionAnchorRowIndex] = true;
+			NotifySelectedRowsChanged();
+		}
+		else if (bSelectionChanged && bModelChangeDeferred)
+		{
+			// The rows are stale until the grid catches up, which then selects the highlighted row
+			SelectedRowMask.Reset();
+			SelectionAnchorRowIndex = INDEX_NONE;
+		}
+
 		if (bSelectionChanged)
 		{
 			CallbackOnRowHighlighted.ExecuteIfBound(HighlightedRowName);
@@ -256,12 +303,7 @@ void FEasyDataTableEditor::PreChange(const UDataTable* Changed, FEasyDataTableEd
 
 void FEasyDataTableEditor::PostChange(const UDataTable* Changed, FEasyDataTableEditorUtils::EDataTableChangeInfo Info)
 {
-	UDataTable* Table = GetEditableDataTable();
-	if (Changed == Table)
-	{
-		// Don't need to notify the DataTable about changes, that's handled before this
-		HandlePostChange();
-	}
+	// Handled by the shared model, see HandleModelChanged
 }
 
 const UDataTable* FEasyDataTableEditor::GetDataTable() const
@@ -270,11 +312,208 @@ const UDataTable* FEasyDataTableEditor::GetDataTable() const
 }
 
 void FEasyDataTableEditor::HandlePostChange()
+{
+	if (Model.IsValid())
+	{
+		Model->Refresh();
+	}
+}
+
+void FEasyDataTableEditor::HandleModelChanged()
+{
+	// The grid pulls the rows from the model when it is created or restored
+	if (!CellsListView.IsValid() || bCachedDataReleased)
+	{
+		return;
+	}
+
+	const bool bRowsReassigned = Model.IsValid() && Model->DidLastBuildReassignRows();
+
+	// A hidden grid catches up when it is painted again, so background editors don't redo every change
+	if (!IsDataTableTabForeground())
+	{
+		bDeferredRowsReassigned |= bRowsReassigned;
+		if (!bModelChangeDeferred)
+		{
+			bModelChangeDeferred = true;
+			DataTableTabWidget->RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &FEasyDataTableEditor::HandleDataTableTabForegrounded));
+		}
+		return;
+	}
+
+	ApplyModelChange(bRowsReassigned);
+}
+
+void FEasyDataTableEditor::ApplyModelChange(bool bRowsReassigned)
 {
 	// We need to cache and restore the selection here as RefreshCachedDataTable will re-create the list view items
 	const FName CachedSelection = HighlightedRowName;
 	HighlightedRowName = NAME_None;
 	RefreshCachedDataTable(CachedSelection, true/*bUpdateEvenIfValid*/);
+
+	// Rows appended by a progressive build are sorted in with the others
+	if (Model.IsValid() && Model->DidLastChangeAppendRows())
+	{
+		if (!SortByColumn.IsNone())
+		{
+			ApplySort();
+		}
+		RestoreReleasedSelection();
+	}
+
+	// Rows are recycled in place, so a widget made for a recycled row would keep showing the old row
+	if (bRowsReassigned && CellsListView.IsValid())
+	{
+		CellsListView->RebuildList();
+	}
+}
+
+bool FEasyDataTableEditor::IsDataTableTabForeground() const
+{
+	TSharedPtr<SDockTab> Tab = DataTableTab.Pin();
+	if (!Tab.IsValid() || !Tab->IsForeground())
+	{
+		return false;
+	}
+
+	TSharedPtr<SDockTab> OwnerTab = TabManager.IsValid() ? TabManager->GetOwnerTab() : nullptr;
+	return !OwnerTab.IsValid() || OwnerTab->IsForeground();
+}
+
+EActiveTimerReturnType FEasyDataTableEditor::HandleDataTableTabForegrounded(double InCurrentTime, float InDeltaTime)
+{
+	FlushDeferredModelChange();
+	return EActiveTimerReturnType::Stop;
+}
+
+void FEasyDataTableEditor::FlushDeferredModelChange()
+{
+	if (bCachedDataReleased)
+	{
+		RestoreCachedData();
+		return;
+	}
+
+	if (!bModelChangeDeferred)
+	{
+		return;
+	}
+
+	// Slots of the old selection may hold other rows now
+	const bool bRowsReassigned = bDeferredRowsReassigned || (Model.IsValid() && Model->DidLastBuildReassignRows());
+	if (bRowsReassigned)
+	{
+		SelectedRowMask.Reset();
+		SelectionAnchorRowIndex = INDEX_NONE;
+	}
+
+	bModelChangeDeferred = false;
+	bDeferredRowsReassigned = false;
+	ApplyModelChange(bRowsReassigned);
+}
+
+bool FEasyDataTableEditor::HandleMemoryPolicyTicker(float DeltaTime)
+{
+	const float ReleaseAfterSeconds = CVarReleaseHiddenTableAfterSeconds.GetValueOnGameThread();
+	if (ReleaseAfterSeconds <= 0.0f || bCachedDataReleased || !CellsListView.IsValid() || IsDataTableTabForeground())
+	{
+		HiddenSinceTime = 0.0;
+		return true;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (HiddenSinceTime == 0.0)
+	{
+		HiddenSinceTime = CurrentTime;
+	}
+	else if (CurrentTime - HiddenSinceTime >= ReleaseAfterSeconds)
+	{
+		HiddenSinceTime = 0.0;
+		ReleaseCachedData();
+	}
+	return true;
+}
+
+void FEasyDataTableEditor::ReleaseCachedData()
+{
+	if (bCachedDataReleased || !CellsListView.IsValid() || !Model.IsValid())
+	{
+		return;
+	}
+
+	// Row slots may hold other rows once rebuilt, so the selection is kept by name
+	GetSelectedRowNames(ReleasedSelectedRowNames);
+	ReleasedScrollOffset = CellsListView->GetScrollOffset();
+
+	// The rebuild applies any change made in the meantime
+	bModelChangeDeferred = false;
+	bDeferredRowsReassigned = false;
+
+	AvailableRows.Empty();
+	VisibleRows.Empty();
+	VisibleRowMask.Empty();
+	VisibleRowIndices.Empty();
+	SelectedRowMask.Empty();
+	SelectionAnchorRowIndex = INDEX_NONE;
+	HighlightedVisibleRowIndex = INDEX_NONE;
+	PendingCellEditRow = nullptr;
+
+	// Row widgets point at the rows the model is about to free
+	CellsListView->RebuildList();
+
+	bCachedDataReleased = true;
+	Model->ReleaseCache();
+
+	DataTableTabWidget->RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &FEasyDataTableEditor::HandleDataTableTabForegrounded));
+}
+
+void FEasyDataTableEditor::RestoreCachedData()
+{
+	if (!bCachedDataReleased)
+	{
+		return;
+	}
+	bCachedDataReleased = false;
+
+	// HighlightedRowName was kept through the release
+	const FName CachedSelection = HighlightedRowName;
+	HighlightedRowName = NAME_None;
+	RefreshCachedDataTable(CachedSelection, true/*bUpdateEvenIfValid*/);
+
+	if (!SortByColumn.IsNone())
+	{
+		ApplySort();
+	}
+
+	RestoreReleasedSelection();
+	CellsListView->SetScrollOffset(ReleasedScrollOffset);
+}
+
+void FEasyDataTableEditor::RestoreReleasedSelection()
+{
+	if (ReleasedSelectedRowNames.IsEmpty() || !Model.IsValid())
+	{
+		return;
+	}
+
+	// Rows a progressive build has not cached yet are selected when they arrive
+	for (int32 NameIndex = ReleasedSelectedRowNames.Num() - 1; NameIndex >= 0; --NameIndex)
+	{
+		const int32 RowIndex = Model->FindRowIndex(ReleasedSelectedRowNames[NameIndex]);
+		if (SelectedRowMask.IsValidIndex(RowIndex))
+		{
+			SelectedRowMask[RowIndex] = true;
+			ReleasedSelectedRowNames.RemoveAtSwap(NameIndex);
+		}
+	}
+
+	if (!Model->IsBuilding())
+	{
+		ReleasedSelectedRowNames.Empty();
+	}
+
+	SelectedRowMask.CombineWithBitwiseAND(VisibleRowMask, EBitwiseOperatorFlags::MaintainSize);
+	NotifySelectedRowsChanged();
 }
 
 void FEasyDataTableEditor::InitDataTableEditor( const EToolkitMode::Type Mode, const TSharedPtr< class IToolkitHost >& InitToolkitHost, UDataTable* Table )
@@ -445,6 +684,10 @@ EColumnSortMode::Type FEasyDataTableEditor::GetColumnSortMode(const FName Column
 
 void FEasyDataTableEditor::OnColumnSortModeChanged(const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_SortByColumn, VisibleRows.Num(), AvailableColumns.Num());
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Indices);
+	const double SortStartTime = FPlatformTime::Seconds();
+
 	int32 ColumnIndex;
 
 	SortMode = InSortMode;
@@ -458,13 +701,79 @@ void FEasyDataTableEditor::OnColumnSortModeChanged(const EColumnSortPriority::Ty
 		}
 	}
 
-	if (AvailableColumns.IsValidIndex(ColumnIndex))
+	const FEasyDataTableNumericColumn* NumericColumn = (AvailableColumns.IsValidIndex(ColumnIndex) && Model.IsValid()) ? Model->FindNumericColumn(ColumnIndex) : nullptr;
+	if (NumericColumn)
 	{
+		// Numeric columns sort by the values in the model's value array, not by their cell text, so values that format alike
+		// still sort apart. NaN ranks above every number
+		const TArray<double>& Values = NumericColumn->Values;
+		auto GetValue = [&Values](const FEasyDataTableEditorRowListViewDataPtr& RowData)
+		{
+			return Values.IsValidIndex(RowData->CellIndex) ? Values[RowData->CellIndex] : TNumericLimits<double>::Lowest();
+		};
+		auto CompareValues = [](double A, double B) -> int32
+		{
+			if (FMath::IsNaN(A) || FMath::IsNaN(B))
+			{
+				return static_cast<int32>(FMath::IsNaN(A)) - static_cast<int32>(FMath::IsNaN(B));
+			}
+			return A < B ? -1 : (A > B ? 1 : 0);
+		};
+
+		// Algo::Sort hands the row pointers to the predicate, TArray::Sort would dereference them
+		if (InSortMode == EColumnSortMode::Ascending)
+		{
+			Algo::Sort(VisibleRows, [&GetValue, &CompareValues](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
+			{
+				const int32 Result = CompareValues(GetValue(first), GetValue(second));
+				return Result ? Result < 0 : first->RowNum < second->RowNum;
+			});
+		}
+		else if (InSortMode == EColumnSortMode::Descending)
+		{
+			Algo::Sort(VisibleRows, [&GetValue, &CompareValues](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
+			{
+				const int32 Result = CompareValues(GetValue(first), GetValue(second));
+				return Result ? Result > 0 : first->RowNum > second->RowNum;
+			});
+		}
+	}
+	else if (AvailableColumns.IsValidIndex(ColumnIndex))
+	{
+		// Order the distinct cell strings once, rows are then sorted by the rank of their cell ID
+		const FEasyDataTableEditorColumnHeaderData& ColumnData = *AvailableColumns[ColumnIndex];
+		TArray<uint32> SortedCellIds;
+		SortedCellIds.SetNumUninitialized(ColumnData.CellStrings.Num());
+		for (int32 CellId = 0; CellId < SortedCellIds.Num(); ++CellId)
+		{
+			SortedCellIds[CellId] = CellId;
+		}
+
+		SortedCellIds.Sort([&ColumnData](uint32 A, uint32 B)
+		{
+			return ColumnData.CellStrings[A].Compare(ColumnData.CellStrings[B]) < 0;
+		});
+
+		TArray<int32> CellRanks;
+		CellRanks.SetNumUninitialized(SortedCellIds.Num());
+		for (int32 Rank = 0; Rank < SortedCellIds.Num(); ++Rank)
+		{
+			// Equal cells share a rank so ties fall back to the row number
+			const bool bSameAsPrevious = Rank > 0 && ColumnData.CellStrings[SortedCellIds[Rank]].Compare(ColumnData.CellStrings[SortedCellIds[Rank - 1]]) == 0;
+			CellRanks[SortedCellIds[Rank]] = bSameAsPrevious ? CellRanks[SortedCellIds[Rank - 1]] : Rank;
+		}
+
+		auto GetCellRank = [&ColumnData, &CellRanks](const FEasyDataTableEditorRowListViewDataPtr& RowData)
+		{
+			return ColumnData.RowCellIds.IsValidIndex(RowData->CellIndex) ? CellRanks[ColumnData.RowCellIds[RowData->CellIndex]] : -1;
+		};
+
+		// Algo::Sort hands the row pointers to the predicate, TArray::Sort would dereference them
 		if (InSortMode == EColumnSortMode::Ascending)
 		{
-			VisibleRows.Sort([ColumnIndex](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
+			Algo::Sort(VisibleRows, [&GetCellRank](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
 			{					
-				int32 Result = (first->CellData[ColumnIndex].ToString()).Compare(second->CellData[ColumnIndex].ToString());
+				int32 Result = GetCellRank(first) - GetCellRank(second);
 
 				if (!Result)
 				{
@@ -478,9 +787,9 @@ void FEasyDataTableEditor::OnColumnSortModeChanged(const EColumnSortPriority::Ty
 		}
 		else if (InSortMode == EColumnSortMode::Descending)
 		{
-			VisibleRows.Sort([ColumnIndex](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
+			Algo::Sort(VisibleRows, [&GetCellRank](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
 			{
-				int32 Result = (first->CellData[ColumnIndex].ToString()).Compare(second->CellData[ColumnIndex].ToString());
+				int32 Result = GetCellRank(first) - GetCellRank(second);
 
 				if (!Result)
 				{
@@ -492,53 +801,79 @@ void FEasyDataTableEditor::OnColumnSortModeChanged(const EColumnSortPriority::Ty
 		}
 	}
 
+	RebuildVisibleRowIndices();
+
+	LastRefreshStats.SortSeconds = FPlatformTime::Seconds() - SortStartTime;
+	bPerformanceStatsTextDirty = true;
+
 	CellsListView->RequestListRefresh();
+	SaveLayoutData();
 }
 
 void FEasyDataTableEditor::OnColumnNumberSortModeChanged(const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_SortByRowNumber, VisibleRows.Num(), AvailableColumns.Num());
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Indices);
+	const double SortStartTime = FPlatformTime::Seconds();
+
 	SortMode = InSortMode;
 	SortByColumn = ColumnId;
 
 	if (InSortMode == EColumnSortMode::Ascending)
 	{
-		VisibleRows.Sort([](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
+		Algo::Sort(VisibleRows, [](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
 		{
 			return first->RowNum < second->RowNum;
 		});
 	}
 	else if (InSortMode == EColumnSortMode::Descending)
 	{
-		VisibleRows.Sort([](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
+		Algo::Sort(VisibleRows, [](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
 		{
 			return first->RowNum > second->RowNum;
 		});
 	}
 
+	RebuildVisibleRowIndices();
+
+	LastRefreshStats.SortSeconds = FPlatformTime::Seconds() - SortStartTime;
+	bPerformanceStatsTextDirty = true;
+
 	CellsListView->RequestListRefresh();
+	SaveLayoutData();
 }
 
 void FEasyDataTableEditor::OnColumnNameSortModeChanged(const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_SortByRowName, VisibleRows.Num(), AvailableColumns.Num());
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Indices);
+	const double SortStartTime = FPlatformTime::Seconds();
+
 	SortMode = InSortMode;
 	SortByColumn = ColumnId;
 
 	if (InSortMode == EColumnSortMode::Ascending)
 	{
-		VisibleRows.Sort([](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
+		Algo::Sort(VisibleRows, [](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
 		{
 			return (first->DisplayName).ToString() < (second->DisplayName).ToString();
 		});
 	}
 	else if (InSortMode == EColumnSortMode::Descending)
 	{
-		VisibleRows.Sort([](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
+		Algo::Sort(VisibleRows, [](const FEasyDataTableEditorRowListViewDataPtr& first, const FEasyDataTableEditorRowListViewDataPtr& second)
 		{
 			return (first->DisplayName).ToString() > (second->DisplayName).ToString();
 		});
 	}
 
+	RebuildVisibleRowIndices();
+
+	LastRefreshStats.SortSeconds = FPlatformTime::Seconds() - SortStartTime;
+	bPerformanceStatsTextDirty = true;
+
 	CellsListView->RequestListRefresh();
+	SaveLayoutData();
 }
 
 void FEasyDataTableEditor::OnEditDataTableStructClicked()
@@ -582,6 +917,20 @@ void FEasyDataTableEditor::FillToolbar(FToolBarBuilder& ToolbarBuilder)
 			LOCTEXT("ReimportText", "Reimport"),
 			LOCTEXT("ReimportTooltip", "Reimport this DataTable"),
 			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Import"));
+		ToolbarBuilder.AddComboButton(
+			FUIAction(
+				FExecuteAction(),
+				FCanExecuteAction::CreateSP(this, &FEasyDataTableEditor::CanImport)),
+			FOnGetContent::CreateSP(this, &FEasyDataTableEditor::MakeImportMenu),
+			LOCTEXT("ImportText", "Import"),
+			LOCTEXT("ImportTooltip", "Import rows from a CSV or JSON file. The file is parsed in the background"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Import"));
+		ToolbarBuilder.AddComboButton(
+			FUIAction(),
+			FOnGetContent::CreateSP(this, &FEasyDataTableEditor::MakeExportMenu),
+			LOCTEXT("ExportText", "Export"),
+			LOCTEXT("ExportTooltip", "Export the table, the filtered rows or the selected rows to a CSV or JSON file"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Save"));
 
 		ToolbarBuilder.AddSeparator();
 
@@ -623,110 +972,562 @@ void FEasyDataTableEditor::FillToolbar(FToolBarBuilder& ToolbarBuilder)
 			LOCTEXT("RemoveRowIconText", "Remove"),
 			LOCTEXT("RemoveRowToolTip", "Remove the currently selected row from the Data Table"),
 			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Delete"));
+		ToolbarBuilder.AddComboButton(
+			FUIAction(),
+			FOnGetContent::CreateSP(this, &FEasyDataTableEditor::MakeSelectionMenu),
+			LOCTEXT("SelectionText", "Select"),
+			LOCTEXT("SelectionToolTip", "Select every filtered row, invert or clear the selection. Edits made in the row editor are applied to every selected row"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.SelectInViewport"));
+
+		ToolbarBuilder.AddSeparator();
+
+		ToolbarBuilder.AddToolBarButton(
+			FUIAction(
+				FExecuteAction::CreateSP(this, &FEasyDataTableEditor::TogglePerformanceStats),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateSP(this, &FEasyDataTableEditor::IsPerformanceStatsVisible)),
+			NAME_None,
+			LOCTEXT("PerformanceStatsText", "Stats"),
+			LOCTEXT("PerformanceStatsToolTip", "Show refresh timings, cache memory and row counts under the grid"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Info"),
+			EUserInterfaceActionType::ToggleButton);
+		ToolbarBuilder.AddToolBarButton(
+			FUIAction(
+				FExecuteAction::CreateSP(this, &FEasyDataTableEditor::ToggleFacetPanel),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateSP(this, &FEasyDataTableEditor::IsFacetPanelVisible)),
+			NAME_None,
+			LOCTEXT("FacetPanelText", "Facets"),
+			LOCTEXT("FacetPanelToolTip", "Show the values of enum, bool, name and gameplay tag columns with their counts, and filter rows by them"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Filter"),
+			EUserInterfaceActionType::ToggleButton);
 	}
 	ToolbarBuilder.EndSection();
 
 }
 
-UDataTable* FEasyDataTableEditor::GetEditableDataTable() const
+TSharedRef<SWidget> FEasyDataTableEditor::MakeImportMenu()
 {
-	return Cast<UDataTable>(GetEditingObject());
+	FMenuBuilder MenuBuilder(true, nullptr);
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ImportReplaceText", "Import and Replace Rows..."),
+		LOCTEXT("ImportReplaceTooltip", "Replace every row of the Data Table with the rows of the file"),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &FEasyDataTableEditor::OnImportClicked, FEasyDataTableImporter::EImportMode::Replace)));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ImportMergeText", "Import and Merge Rows..."),
+		LOCTEXT("ImportMergeTooltip", "Add the rows of the file, overwriting rows with the same name"),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &FEasyDataTableEditor::OnImportClicked, FEasyDataTableImporter::EImportMode::Merge)));
+	return MenuBuilder.MakeWidget();
 }
 
-FText FEasyDataTableEditor::GetBaseToolkitName() const
+void FEasyDataTableEditor::OnImportClicked(FEasyDataTableImporter::EImportMode ImportMode)
 {
-	return LOCTEXT( "AppLabel", "DataTable Editor" );
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	UDataTable* Table = GetEditableDataTable();
+	if (!DesktopPlatform || !Table || !CanImport())
+	{
+		return;
+	}
+
+	TArray<FString> Filenames;
+	const bool bOpened = DesktopPlatform->OpenFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr),
+		LOCTEXT("ImportDialogTitle", "Import Data Table Rows").ToString(),
+		FPaths::ProjectDir(),
+		TEXT(""),
+		TEXT("Data Table Files (*.csv;*.json)|*.csv;*.json"),
+		EFileDialogFlags::None,
+		Filenames);
+
+	if (bOpened && Filenames.Num() > 0)
+	{
+		ActiveImport = FEasyDataTableImporter::StartImport(Table, Filenames[0], ImportMode);
+	}
 }
 
-FString FEasyDataTableEditor::GetWorldCentricTabPrefix() const
+bool FEasyDataTableEditor::CanImport() const
 {
-	return LOCTEXT("WorldCentricTabPrefix", "DataTable ").ToString();
+	return CanEditRows() && GetEditableDataTable() != nullptr && !(ActiveImport.IsValid() && ActiveImport->IsRunning());
 }
 
-FLinearColor FEasyDataTableEditor::GetWorldCentricTabColorScale() const
+TSharedRef<SWidget> FEasyDataTableEditor::MakeExportMenu()
 {
-	return FLinearColor( 0.0f, 0.0f, 0.2f, 0.5f );
+	// The entries read the visible and selected rows
+	FlushDeferredModelChange();
+
+	FMenuBuilder MenuBuilder(true, nullptr);
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ExportTableText", "Export Table..."),
+		LOCTEXT("ExportTableTooltip", "Export every row of the Data Table"),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &FEasyDataTableEditor::OnExportClicked, EExportScope::Table),
+			FCanExecuteAction::CreateSP(this, &FEasyDataTableEditor::CanExport, EExportScope::Table)));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ExportVisibleRowsText", "Export Filtered Rows..."),
+		LOCTEXT("ExportVisibleRowsTooltip", "Export the rows that match the search filter, in the displayed order"),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &FEasyDataTableEditor::OnExportClicked, EExportScope::VisibleRows),
+			FCanExecuteAction::CreateSP(this, &FEasyDataTableEditor::CanExport, EExportScope::VisibleRows)));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ExportSelectedRowsText", "Export Selected Rows..."),
+		LOCTEXT("ExportSelectedRowsTooltip", "Export the selected rows, in the displayed order"),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &FEasyDataTableEditor::OnExportClicked, EExportScope::SelectedRows),
+			FCanExecuteAction::CreateSP(this, &FEasyDataTableEditor::CanExport, EExportScope::SelectedRows)));
+	return MenuBuilder.MakeWidget();
 }
 
-FSlateColor FEasyDataTableEditor::GetRowTextColor(FName RowName) const
+void FEasyDataTableEditor::OnExportClicked(EExportScope Scope)
 {
-	if (RowName == HighlightedRowName)
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	const UDataTable* Table = GetDataTable();
+	if (!DesktopPlatform || !Table)
 	{
-		return FSlateColor(FColorList::Orange);
+		return;
 	}
-	return FSlateColor::UseForeground();
-}
 
-FText FEasyDataTableEditor::GetCellText(FEasyDataTableEditorRowListViewDataPtr InRowDataPointer, int32 ColumnIndex) const
-{
-	if (InRowDataPointer.IsValid() && ColumnIndex < InRowDataPointer->CellData.Num())
+	TArray<FString> Filenames;
+	const bool bSaved = DesktopPlatform->SaveFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr),
+		LOCTEXT("ExportDialogTitle", "Export Data Table Rows").ToString(),
+		FPaths::ProjectDir(),
+		Table->GetName() + TEXT(".csv"),
+		TEXT("CSV File (*.csv)|*.csv|JSON File (*.json)|*.json"),
+		EFileDialogFlags::None,
+		Filenames);
+	if (!bSaved || Filenames.Num() == 0)
 	{
-		return InRowDataPointer->CellData[ColumnIndex];
+		return;
 	}
 
-	return FText();
+	FString Error;
+	bool bSuccess = false;
+	if (Scope == EExportScope::Table)
+	{
+		bSuccess = FEasyDataTableExporter::ExportTable(Table, Filenames[0], Error);
+	}
+	else
+	{
+		TArray<FName> RowNames;
+		RowNames.Reserve(VisibleRows.Num());
+		for (const FEasyDataTableEditorRowListViewDataPtr& Row : VisibleRows)
+		{
+			if (Scope == EExportScope::VisibleRows || SelectedRowMask[Row->CellIndex])
+			{
+				RowNames.Add(Row->RowId);
+			}
+		}
+		bSuccess = FEasyDataTableExporter::ExportRows(Table, RowNames, Filenames[0], Error);
+	}
+
+	FNotificationInfo Info(bSuccess
+		? FText::Format(LOCTEXT("ExportSucceeded", "Exported {0}"), FText::FromString(FPaths::GetCleanFilename(Filenames[0])))
+		: FText::Format(LOCTEXT("ExportFailed", "Export failed: {0}"), FText::FromString(Error)));
+	Info.ExpireDuration = 3.0f;
+	FSlateNotificationManager::Get().AddNotification(Info);
 }
 
-FText FEasyDataTableEditor::GetCellToolTipText(FEasyDataTableEditorRowListViewDataPtr InRowDataPointer, int32 ColumnIndex) const
+bool FEasyDataTableEditor::CanExport(EExportScope Scope) const
 {
-	FText TooltipText;
-
-	if (ColumnIndex < AvailableColumns.Num())
+	if (!GetDataTable())
 	{
-		TooltipText = AvailableColumns[ColumnIndex]->DisplayName;
+		return false;
+	}
+	switch (Scope)
+	{
+	case EExportScope::VisibleRows:
+		return VisibleRows.Num() > 0;
+	case EExportScope::SelectedRows:
+		return HasSelectedRows();
+	default:
+		return true;
 	}
+}
 
-	if (InRowDataPointer.IsValid() && ColumnIndex < InRowDataPointer->CellData.Num())
+void FEasyDataTableEditor::TogglePerformanceStats()
+{
+	bShowPerformanceStats = !bShowPerformanceStats;
+
+	// The cache size is only tracked while the strip is visible
+	if (bShowPerformanceStats)
 	{
-		TooltipText = FText::Format(LOCTEXT("ColumnRowNameFmt", "{0}: {1}"), TooltipText, InRowDataPointer->CellData[ColumnIndex]);
+		LastRefreshStats.CacheBytes = GetCachedDataAllocatedSize();
 	}
+	bPerformanceStatsTextDirty = true;
 
-	return TooltipText;
+	SaveLayoutData();
 }
 
-float FEasyDataTableEditor::GetRowNumberColumnWidth() const
+bool FEasyDataTableEditor::IsPerformanceStatsVisible() const
 {
-	return RowNumberColumnWidth;
+	return bShowPerformanceStats;
 }
 
-void FEasyDataTableEditor::RefreshRowNumberColumnWidth()
+EVisibility FEasyDataTableEditor::GetPerformanceStatsVisibility() const
 {
+	return bShowPerformanceStats ? EVisibility::Visible : EVisibility::Collapsed;
+}
 
-	TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
-	const FTextBlockStyle& CellTextStyle = FAppStyle::GetWidgetStyle<FTextBlockStyle>("DataTableEditor.CellText");
-	const float CellPadding = 10.0f;
+EVisibility FEasyDataTableEditor::GetCacheProgressVisibility() const
+{
+	return Model.IsValid() && Model->IsBuilding() ? EVisibility::Visible : EVisibility::Collapsed;
+}
 
-	for (const FEasyDataTableEditorRowListViewDataPtr& RowData : AvailableRows)
+TOptional<float> FEasyDataTableEditor::GetCacheProgressPercent() const
+{
+	const int32 NumRowsToBuild = Model.IsValid() ? Model->GetNumRowsToBuild() : 0;
+	return NumRowsToBuild > 0 ? static_cast<float>(Model->GetRows().Num()) / NumRowsToBuild : 0.0f;
+}
+
+FText FEasyDataTableEditor::GetCacheProgressText() const
+{
+	if (!Model.IsValid())
 	{
-		const float RowNumberWidth = (float)FontMeasure->Measure(FString::FromInt(RowData->RowNum), CellTextStyle.Font).X + CellPadding;
-		RowNumberColumnWidth = FMath::Max(RowNumberColumnWidth, RowNumberWidth);
+		return FText::GetEmpty();
 	}
 
+	return FText::Format(LOCTEXT("CacheProgressFmt", "Loading rows {0} / {1}"), FText::AsNumber(Model->GetRows().Num()), FText::AsNumber(Model->GetNumRowsToBuild()));
 }
 
-void FEasyDataTableEditor::OnRowNumberColumnResized(const float NewWidth)
+TSharedRef<SWidget> FEasyDataTableEditor::MakeSelectionMenu()
 {
-	RowNumberColumnWidth = NewWidth;
+	FlushDeferredModelChange();
+
+	FMenuBuilder MenuBuilder(true, nullptr);
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("SelectAllVisibleRowsText", "Select All Filtered Rows"),
+		LOCTEXT("SelectAllVisibleRowsTooltip", "Select every row that matches the search filter and facets"),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &FEasyDataTableEditor::SelectAllVisibleRows)));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("InvertRowSelectionText", "Invert Selection"),
+		LOCTEXT("InvertRowSelectionTooltip", "Select the filtered rows that are not selected and deselect the others"),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &FEasyDataTableEditor::InvertRowSelection)));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("SelectRowsModifiedFromDefaultText", "Select Modified Rows"),
+		LOCTEXT("SelectRowsModifiedFromDefaultTooltip", "Select the filtered rows whose values differ from the struct defaults"),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &FEasyDataTableEditor::SelectRowsModifiedFromDefault),
+			FCanExecuteAction::CreateSP(this, &FEasyDataTableEditor::HasStructDefaults)));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ClearRowSelectionText", "Clear Selection"),
+		LOCTEXT("ClearRowSelectionTooltip", "Deselect every row but the highlighted one"),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &FEasyDataTableEditor::ClearRowSelection),
+			FCanExecuteAction::CreateSP(this, &FEasyDataTableEditor::HasSelectedRows)));
+	return MenuBuilder.MakeWidget();
 }
 
-float FEasyDataTableEditor::GetRowNameColumnWidth() const
+void FEasyDataTableEditor::SelectAllVisibleRows()
 {
-	return RowNameColumnWidth;
+	SelectedRowMask = VisibleRowMask;
+	NotifySelectedRowsChanged();
 }
 
-void FEasyDataTableEditor::RefreshRowNameColumnWidth()
+void FEasyDataTableEditor::InvertRowSelection()
 {
-	
-	TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
-	const FTextBlockStyle& CellTextStyle = FAppStyle::GetWidgetStyle<FTextBlockStyle>("DataTableEditor.CellText");
-	static const float CellPadding = 10.0f;
+	SelectedRowMask.BitwiseNOT();
+	SelectedRowMask.CombineWithBitwiseAND(VisibleRowMask, EBitwiseOperatorFlags::MaintainSize);
+	NotifySelectedRowsChanged();
+}
 
-	for (const FEasyDataTableEditorRowListViewDataPtr& RowData : AvailableRows)
+void FEasyDataTableEditor::ClearRowSelection()
+{
+	SelectedRowMask.Init(false, AvailableRows.Num());
+	if (VisibleRows.IsValidIndex(HighlightedVisibleRowIndex))
 	{
-		const float RowNameWidth = (float)FontMeasure->Measure(RowData->DisplayName, CellTextStyle.Font).X + CellPadding;
-		RowNameColumnWidth = FMath::Max(RowNameColumnWidth, RowNameWidth);
+		SelectedRowMask[VisibleRows[HighlightedVisibleRowIndex]->CellIndex] = true;
 	}
-	
+	NotifySelectedRowsChanged();
+}
+
+void FEasyDataTableEditor::SelectRowsModifiedFromDefault()
+{
+	if (Model.IsValid())
+	{
+		SelectedRowMask = Model->GetRowsDifferingFromDefault();
+		SelectedRowMask.SetNum(AvailableRows.Num(), false);
+		SelectedRowMask.CombineWithBitwiseAND(VisibleRowMask, EBitwiseOperatorFlags::MaintainSize);
+		NotifySelectedRowsChanged();
+	}
+}
+
+bool FEasyDataTableEditor::HasSelectedRows() const
+{
+	return SelectedRowMask.Contains(true);
+}
+
+void FEasyDataTableEditor::SelectVisibleRowRange(int32 FirstVisibleIndex, int32 LastVisibleIndex)
+{
+	if (FirstVisibleIndex > LastVisibleIndex)
+	{
+		Swap(FirstVisibleIndex, LastVisibleIndex);
+	}
+	FirstVisibleIndex = FMath::Max(FirstVisibleIndex, 0);
+	LastVisibleIndex = FMath::Min(LastVisibleIndex, VisibleRows.Num() - 1);
+
+	for (int32 VisibleIndex = FirstVisibleIndex; VisibleIndex <= LastVisibleIndex; ++VisibleIndex)
+	{
+		SelectedRowMask[VisibleRows[VisibleIndex]->CellIndex] = true;
+	}
+}
+
+bool FEasyDataTableEditor::IsRowSelected(FEasyDataTableEditorRowListViewDataPtr RowData) const
+{
+	return RowData && SelectedRowMask.IsValidIndex(RowData->CellIndex) && SelectedRowMask[RowData->CellIndex];
+}
+
+void FEasyDataTableEditor::GetSelectedRowNames(TArray<FName>& OutRowNames) const
+{
+	if (bCachedDataReleased)
+	{
+		OutRowNames = ReleasedSelectedRowNames;
+		return;
+	}
+
+	OutRowNames.Reset();
+	for (TConstSetBitIterator<> It(SelectedRowMask); It; ++It)
+	{
+		if (AvailableRows.IsValidIndex(It.GetIndex()))
+		{
+			OutRowNames.Add(AvailableRows[It.GetIndex()]->RowId);
+		}
+	}
+}
+
+void FEasyDataTableEditor::NotifySelectedRowsChanged()
+{
+	CallbackOnSelectedRowsChanged.ExecuteIfBound();
+}
+
+void FEasyDataTableEditor::ToggleFacetPanel()
+{
+	bShowFacetPanel = !bShowFacetPanel;
+
+	// The value counts are only kept up to date while the panel is visible
+	if (bShowFacetPanel && FacetPanel.IsValid())
+	{
+		FacetPanel->Refresh(AvailableColumns);
+	}
+
+	if (FacetPanel.IsValid() && FacetPanel->HasActiveFacets())
+	{
+		UpdateVisibleRows();
+	}
+
+	SaveLayoutData();
+}
+
+bool FEasyDataTableEditor::IsFacetPanelVisible() const
+{
+	return bShowFacetPanel;
+}
+
+EVisibility FEasyDataTableEditor::GetFacetPanelVisibility() const
+{
+	return bShowFacetPanel ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+void FEasyDataTableEditor::OnFacetsChanged()
+{
+	UpdateVisibleRows();
+}
+
+FText FEasyDataTableEditor::GetPerformanceStatsText() const
+{
+	const int32 NumGeneratedRowWidgets = CellsListView.IsValid() ? CellsListView->GetNumGeneratedChildren() : 0;
+	if (!bPerformanceStatsTextDirty && NumGeneratedRowWidgets == CachedNumGeneratedRowWidgets)
+	{
+		return CachedPerformanceStatsText;
+	}
+
+	FNumberFormattingOptions MillisecondsFormat;
+	MillisecondsFormat.SetMinimumFractionalDigits(1);
+	MillisecondsFormat.SetMaximumFractionalDigits(1);
+
+	auto AsMilliseconds = [&MillisecondsFormat](double Seconds)
+	{
+		return FText::AsNumber(Seconds * 1000.0, &MillisecondsFormat);
+	};
+
+	const FRefreshStats& Stats = LastRefreshStats;
+	const double TotalSeconds = Stats.CellTextSeconds + Stats.MeasureSeconds + Stats.FilterSeconds + Stats.SortSeconds + Stats.WidgetGenerationSeconds;
+
+	FFormatNamedArguments Args;
+	Args.Add(TEXT("Total"), AsMilliseconds(TotalSeconds));
+	Args.Add(TEXT("CellText"), AsMilliseconds(Stats.CellTextSeconds));
+	Args.Add(TEXT("Measure"), AsMilliseconds(Stats.MeasureSeconds));
+	Args.Add(TEXT("Filter"), AsMilliseconds(Stats.FilterSeconds));
+	Args.Add(TEXT("Sort"), AsMilliseconds(Stats.SortSeconds));
+	Args.Add(TEXT("Widgets"), AsMilliseconds(Stats.WidgetGenerationSeconds));
+	Args.Add(TEXT("CacheMemory"), FText::AsMemory(Stats.CacheBytes));
+	Args.Add(TEXT("VisibleRows"), FText::AsNumber(VisibleRows.Num()));
+	Args.Add(TEXT("TotalRows"), FText::AsNumber(AvailableRows.Num()));
+	Args.Add(TEXT("RowWidgets"), FText::AsNumber(NumGeneratedRowWidgets));
+
+	CachedPerformanceStatsText = FText::Format(LOCTEXT("PerformanceStatsFmt",
+		"Last refresh {Total} ms (cell text {CellText}, measure {Measure}, filter {Filter}, sort {Sort}, widgets {Widgets})   |   Cache {CacheMemory}   |   Rows {VisibleRows} / {TotalRows}   |   Row widgets {RowWidgets}"),
+		Args);
+	CachedNumGeneratedRowWidgets = NumGeneratedRowWidgets;
+	bPerformanceStatsTextDirty = false;
+
+	return CachedPerformanceStatsText;
+}
+
+SIZE_T FEasyDataTableEditor::GetCachedDataAllocatedSize() const
+{
+	SIZE_T AllocatedSize = AvailableColumns.GetAllocatedSize() + AvailableRows.GetAllocatedSize() + VisibleRows.GetAllocatedSize();
+	if (Model.IsValid())
+	{
+		AllocatedSize += Model->GetAllocatedSize();
+	}
+
+	return AllocatedSize;
+}
+
+UDataTable* FEasyDataTableEditor::GetEditableDataTable() const
+{
+	return Cast<UDataTable>(GetEditingObject());
+}
+
+FText FEasyDataTableEditor::GetBaseToolkitName() const
+{
+	return LOCTEXT( "AppLabel", "DataTable Editor" );
+}
+
+FString FEasyDataTableEditor::GetWorldCentricTabPrefix() const
+{
+	return LOCTEXT("WorldCentricTabPrefix", "DataTable ").ToString();
+}
+
+FLinearColor FEasyDataTableEditor::GetWorldCentricTabColorScale() const
+{
+	return FLinearColor( 0.0f, 0.0f, 0.2f, 0.5f );
+}
+
+FSlateColor FEasyDataTableEditor::GetRowTextColor(FName RowName) const
+{
+	if (RowName == HighlightedRowName)
+	{
+		return FSlateColor(FColorList::Orange);
+	}
+	return FSlateColor::UseForeground();
+}
+
+FText FEasyDataTableEditor::GetCellText(FEasyDataTableEditorRowListViewDataPtr InRowDataPointer, int32 ColumnIndex) const
+{
+	if (InRowDataPointer && AvailableColumns.IsValidIndex(ColumnIndex))
+	{
+		return AvailableColumns[ColumnIndex]->GetCellText(InRowDataPointer->CellIndex);
+	}
+
+	return FText();
+}
+
+bool FEasyDataTableEditor::HasStructDefaults() const
+{
+	const UDataTable* Table = GetDataTable();
+	return Table && Cast<const UUserDefinedStruct>(Table->GetRowStruct()) != nullptr;
+}
+
+EVisibility FEasyDataTableEditor::GetRowModifiedMarkerVisibility(FEasyDataTableEditorRowListViewDataPtr InRowDataPointer) const
+{
+	return Model.IsValid() && InRowDataPointer && Model->DoesRowDifferFromDefault(InRowDataPointer->CellIndex)
+		? EVisibility::Visible
+		: EVisibility::Hidden;
+}
+
+FText FEasyDataTableEditor::GetColumnHeaderToolTipText(int32 ColumnIndex) const
+{
+	if (!AvailableColumns.IsValidIndex(ColumnIndex))
+	{
+		return FText::GetEmpty();
+	}
+
+	const FText TypeText = FEasyDataTableEditorUtils::GetRowTypeInfoTooltipText(AvailableColumns[ColumnIndex]);
+
+	// Only evaluated while the tooltip is open, so the statistics are computed on demand
+	FText SummaryText;
+	if (!Model.IsValid() || !Model->GetColumnSummaryText(ColumnIndex, SummaryText))
+	{
+		return TypeText;
+	}
+
+	if (SummaryText.IsEmpty())
+	{
+		SummaryText = LOCTEXT("ComputingColumnSummary", "Computing column statistics...");
+	}
+	return FText::Format(LOCTEXT("ColumnHeaderToolTipFmt", "{0}\n\n{1}"), TypeText, SummaryText);
+}
+
+FText FEasyDataTableEditor::GetCellToolTipText(FEasyDataTableEditorRowListViewDataPtr InRowDataPointer, int32 ColumnIndex) const
+{
+	FText TooltipText;
+
+	if (ColumnIndex < AvailableColumns.Num())
+	{
+		TooltipText = AvailableColumns[ColumnIndex]->DisplayName;
+	}
+
+	if (InRowDataPointer && AvailableColumns.IsValidIndex(ColumnIndex))
+	{
+		TooltipText = FText::Format(LOCTEXT("ColumnRowNameFmt", "{0}: {1}"), TooltipText, AvailableColumns[ColumnIndex]->GetCellText(InRowDataPointer->CellIndex));
+	}
+
+	return TooltipText;
+}
+
+float FEasyDataTableEditor::GetRowNumberColumnWidth() const
+{
+	return RowNumberColumnWidth;
+}
+
+void FEasyDataTableEditor::RefreshRowNumberColumnWidth()
+{
+
+	TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	const FTextBlockStyle& CellTextStyle = FAppStyle::GetWidgetStyle<FTextBlockStyle>("DataTableEditor.CellText");
+	const float CellPadding = 10.0f;
+
+	for (const FEasyDataTableEditorRowListViewDataPtr& RowData : AvailableRows)
+	{
+		const float RowNumberWidth = (float)FontMeasure->Measure(FString::FromInt(RowData->RowNum), CellTextStyle.Font).X + CellPadding;
+		RowNumberColumnWidth = FMath::Max(RowNumberColumnWidth, RowNumberWidth);
+	}
+
+}
+
+void FEasyDataTableEditor::OnRowNumberColumnResized(const float NewWidth)
+{
+	RowNumberColumnWidth = NewWidth;
+}
+
+float FEasyDataTableEditor::GetRowNameColumnWidth() const
+{
+	return RowNameColumnWidth;
+}
+
+void FEasyDataTableEditor::RefreshRowNameColumnWidth()
+{
+	
+	TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	const FTextBlockStyle& CellTextStyle = FAppStyle::GetWidgetStyle<FTextBlockStyle>("DataTableEditor.CellText");
+	static const float CellPadding = 10.0f;
+
+	for (const FEasyDataTableEditorRowListViewDataPtr& RowData : AvailableRows)
+	{
+		const float RowNameWidth = (float)FontMeasure->Measure(RowData->DisplayName, CellTextStyle.Font).X + CellPadding;
+		RowNameColumnWidth = FMath::Max(RowNameColumnWidth, RowNameWidth);
+	}
+	
 }
 
 float FEasyDataTableEditor::GetColumnWidth(const int32 ColumnIndex) const
@@ -767,6 +1568,8 @@ void FEasyDataTableEditor::OnColumnResized(const float NewWidth, const int32 Col
 			const FString& ColumnName = AvailableColumns[ColumnIndex]->ColumnId.ToString();
 			LayoutColumnWidths->SetNumberField(ColumnName, NewWidth);
 		}
+
+		SaveLayoutData();
 	}
 }
 
@@ -785,41 +1588,163 @@ void FEasyDataTableEditor::LoadLayoutData()
 		return;
 	}
 
-	const FString LayoutDataFilename = FPaths::ProjectSavedDir() / TEXT("AssetData") / TEXT("DataTableEditorLayout") / Table->GetName() + TEXT(".json");
+	LayoutData = FEasyDataTableLayoutStore::Get().FindOrAddLayout(Table->GetOutermost()->GetName(), Table->GetName());
+
+	LayoutData->TryGetBoolField(TEXT("ShowPerformanceStats"), bShowPerformanceStats);
+	LayoutData->TryGetBoolField(TEXT("ShowFacetPanel"), bShowFacetPanel);
 
-	FString JsonText;
-	if (FFileHelper::LoadFileToString(JsonText, *LayoutDataFilename))
+	FString FilterString;
+	if (LayoutData->TryGetStringField(TEXT("FilterText"), FilterString))
 	{
-		TSharedRef< TJsonReader<TCHAR> > JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonText);
-		FJsonSerializer::Deserialize(JsonReader, LayoutData);
+		ActiveFilterText = FText::FromString(FilterString);
+	}
+
+	FString SortColumnString;
+	int32 SortModeValue = 0;
+	if (LayoutData->TryGetStringField(TEXT("SortColumn"), SortColumnString) && LayoutData->TryGetNumberField(TEXT("SortMode"), SortModeValue))
+	{
+		SortByColumn = FName(*SortColumnString);
+		SortMode = static_cast<EColumnSortMode::Type>(FMath::Clamp(SortModeValue, (int32)EColumnSortMode::None, (int32)EColumnSortMode::Descending));
+	}
+
+	TArray<FString> ColumnNames;
+	HiddenColumnIds.Reset();
+	if (LayoutData->TryGetStringArrayField(TEXT("HiddenColumns"), ColumnNames))
+	{
+		for (const FString& ColumnName : ColumnNames)
+		{
+			HiddenColumnIds.Add(FName(*ColumnName));
+		}
+	}
+
+	ColumnNames.Reset();
+	ColumnOrder.Reset();
+	if (LayoutData->TryGetStringArrayField(TEXT("ColumnOrder"), ColumnNames))
+	{
+		for (const FString& ColumnName : ColumnNames)
+		{
+			ColumnOrder.Add(FName(*ColumnName));
+		}
 	}
 }
 
 void FEasyDataTableEditor::SaveLayoutData()
 {
-	const UDataTable* Table = GetDataTable();
-	if (!Table || !LayoutData.IsValid())
+	if (!LayoutData.IsValid())
 	{
 		return;
 	}
 
-	const FString LayoutDataFilename = FPaths::ProjectSavedDir() / TEXT("AssetData") / TEXT("DataTableEditorLayout") / Table->GetName() + TEXT(".json");
+	LayoutData->SetBoolField(TEXT("ShowPerformanceStats"), bShowPerformanceStats);
+	LayoutData->SetBoolField(TEXT("ShowFacetPanel"), bShowFacetPanel);
+	LayoutData->SetStringField(TEXT("FilterText"), ActiveFilterText.ToString());
+	LayoutData->SetStringField(TEXT("SortColumn"), SortByColumn.ToString());
+	LayoutData->SetNumberField(TEXT("SortMode"), SortMode);
 
-	FString JsonText;
-	TSharedRef< TJsonWriter< TCHAR, TPrettyJsonPrintPolicy<TCHAR> > > JsonWriter = TJsonWriterFactory< TCHAR, TPrettyJsonPrintPolicy<TCHAR> >::Create(&JsonText);
-	if (FJsonSerializer::Serialize(LayoutData.ToSharedRef(), JsonWriter))
+	TArray<TSharedPtr<FJsonValue>> HiddenColumnValues;
+	for (const FName& ColumnId : HiddenColumnIds)
 	{
-		FFileHelper::SaveStringToFile(JsonText, *LayoutDataFilename);
+		HiddenColumnValues.Add(MakeShared<FJsonValueString>(ColumnId.ToString()));
 	}
+	LayoutData->SetArrayField(TEXT("HiddenColumns"), HiddenColumnValues);
+
+	TArray<TSharedPtr<FJsonValue>> ColumnOrderValues;
+	for (const FName& ColumnId : ColumnOrder)
+	{
+		ColumnOrderValues.Add(MakeShared<FJsonValueString>(ColumnId.ToString()));
+	}
+	LayoutData->SetArrayField(TEXT("ColumnOrder"), ColumnOrderValues);
+
+	// The store coalesces changes and writes them in the background
+	FEasyDataTableLayoutStore::Get().MarkDirty();
 }
 
 TSharedRef<ITableRow> FEasyDataTableEditor::MakeRowWidget(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, const TSharedRef<STableViewBase>& OwnerTable)
 {
-	return
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_MakeRowWidget, VisibleRows.Num(), AvailableColumns.Num());
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Widgets);
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSharedRef<ITableRow> RowWidget =
 		SNew(SEasyDataTableListViewRow, OwnerTable)
 		.DataTableEditor(SharedThis(this))
 		.RowDataPtr(InRowDataPtr)
 		.IsEditable(CanEditRows());
+
+	LastRefreshStats.WidgetGenerationSeconds += FPlatformTime::Seconds() - StartTime;
+	bPerformanceStatsTextDirty = true;
+
+	return RowWidget;
+}
+
+void FEasyDataTableEditor::BeginCellEdit(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, int32 ColumnIndex)
+{
+	if (!InRowDataPtr || !CellsListView.IsValid())
+	{
+		return;
+	}
+
+	// The row widget may not exist yet, OnItemScrolledIntoView starts the edit once it does
+	PendingCellEditRow = InRowDataPtr;
+	PendingCellEditColumnIndex = ColumnIndex;
+	CellsListView->RequestScrollIntoView(InRowDataPtr);
+}
+
+void FEasyDataTableEditor::MoveCellEdit(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, int32 ColumnIndex, int32 RowOffset, int32 ColumnOffset)
+{
+	if (!InRowDataPtr)
+	{
+		return;
+	}
+
+	if (RowOffset != 0)
+	{
+		const int32 VisibleRowIndex = VisibleRowIndices.IsValidIndex(InRowDataPtr->CellIndex) ? VisibleRowIndices[InRowDataPtr->CellIndex] : INDEX_NONE;
+		const int32 TargetVisibleRowIndex = VisibleRowIndex + RowOffset;
+		if (VisibleRowIndex != INDEX_NONE && VisibleRows.IsValidIndex(TargetVisibleRowIndex))
+		{
+			BeginCellEdit(VisibleRows[TargetVisibleRowIndex], ColumnIndex);
+		}
+		return;
+	}
+
+	// Skip the displayed columns that can't be edited inline
+	const TArray<int32> DisplayedColumnIndices = GetDisplayedColumnIndices();
+	const int32 Step = ColumnOffset < 0 ? -1 : 1;
+	for (int32 DisplayIndex = DisplayedColumnIndices.IndexOfByKey(ColumnIndex) + Step; DisplayedColumnIndices.IsValidIndex(DisplayIndex); DisplayIndex += Step)
+	{
+		const int32 TargetColumnIndex = DisplayedColumnIndices[DisplayIndex];
+		if (FEasyDataTableEditorUtils::CanEditCellInline(AvailableColumns[TargetColumnIndex]->Property))
+		{
+			BeginCellEdit(InRowDataPtr, TargetColumnIndex);
+			return;
+		}
+	}
+}
+
+void FEasyDataTableEditor::OnItemScrolledIntoView(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, const TSharedPtr<ITableRow>& InWidget)
+{
+	if (InRowDataPtr != PendingCellEditRow || !InWidget.IsValid())
+	{
+		return;
+	}
+
+	const int32 ColumnIndex = PendingCellEditColumnIndex;
+	PendingCellEditRow = nullptr;
+	PendingCellEditColumnIndex = INDEX_NONE;
+
+	StaticCastSharedPtr<SEasyDataTableListViewRow>(InWidget)->BeginCellEdit(ColumnIndex);
+}
+
+bool FEasyDataTableEditor::SetCellValue(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, int32 ColumnIndex, const FString& Value)
+{
+	UDataTable* Table = GetEditableDataTable();
+	if (!Table || !InRowDataPtr || !AvailableColumns.IsValidIndex(ColumnIndex))
+	{
+		return false;
+	}
+
+	return FEasyDataTableEditorUtils::SetCellValue(Table, InRowDataPtr->RowId, AvailableColumns[ColumnIndex]->ColumnId, Value);
 }
 
 TSharedRef<SWidget> FEasyDataTableEditor::MakeCellWidget(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, const int32 InRowIndex, const FName& InColumnId)
@@ -835,7 +1760,7 @@ TSharedRef<SWidget> FEasyDataTableEditor::MakeCellWidget(FEasyDataTableEditorRow
 	}
 
 	// Valid column ID?
-	if (AvailableColumns.IsValidIndex(ColumnIndex) && InRowDataPtr->CellData.IsValidIndex(ColumnIndex))
+	if (AvailableColumns.IsValidIndex(ColumnIndex) && AvailableColumns[ColumnIndex]->RowCellIds.IsValidIndex(InRowDataPtr->CellIndex))
 	{
 		return SNew(SBox)
 			.Padding(FMargin(4, 2, 4, 2))
@@ -854,15 +1779,95 @@ TSharedRef<SWidget> FEasyDataTableEditor::MakeCellWidget(FEasyDataTableEditorRow
 
 void FEasyDataTableEditor::OnRowSelectionChanged(FEasyDataTableEditorRowListViewDataPtr InNewSelection, ESelectInfo::Type InSelectInfo)
 {
-	const bool bSelectionChanged = !InNewSelection.IsValid() || InNewSelection->RowId != HighlightedRowName;
-	const FName NewRowName = (InNewSelection.IsValid()) ? InNewSelection->RowId : NAME_None;
+	// The list view runs in single selection, ctrl and shift are applied to the selection mask here
+	if (InNewSelection && InSelectInfo != ESelectInfo::Direct && SelectedRowMask.IsValidIndex(InNewSelection->CellIndex))
+	{
+		const FModifierKeysState ModifierKeys = FSlateApplication::Get().GetModifierKeys();
+		const int32 RowIndex = InNewSelection->CellIndex;
+
+		const int32 AnchorVisibleIndex = ModifierKeys.IsShiftDown() && VisibleRowIndices.IsValidIndex(SelectionAnchorRowIndex)
+			? VisibleRowIndices[SelectionAnchorRowIndex]
+			: INDEX_NONE;
+
+		if (AnchorVisibleIndex != INDEX_NONE && VisibleRowIndices.IsValidIndex(RowIndex))
+		{
+			SelectedRowMask.Init(false, AvailableRows.Num());
+			SelectVisibleRowRange(AnchorVisibleIndex, VisibleRowIndices[RowIndex]);
+		}
+		else if (ModifierKeys.IsControlDown())
+		{
+			// Ctrl clicks are toggled by the row, see ApplyModifierClick. The new selection becomes the highlighted row,
+			// which is always selected
+			SelectedRowMask[RowIndex] = true;
+			SelectionAnchorRowIndex = RowIndex;
+		}
+		else
+		{
+			SelectedRowMask.Init(false, AvailableRows.Num());
+			SelectedRowMask[RowIndex] = true;
+			SelectionAnchorRowIndex = RowIndex;
+		}
+		NotifySelectedRowsChanged();
+	}
+
+	const bool bSelectionChanged = !InNewSelection || InNewSelection->RowId != HighlightedRowName;
+	const FName NewRowName = (InNewSelection) ? InNewSelection->RowId : NAME_None;
 
 	SetHighlightedRow(NewRowName);
 	
 	if (bSelectionChanged)
 	{
-		CallbackOnRowHighlighted.ExecuteIfBound(HighlightedRowName);
+		CallbackOnRowHighlighted.ExecuteIfBound(HighlightedRowName);
+	}
+}
+
+bool FEasyDataTableEditor::ApplyModifierClick(FEasyDataTableEditorRowListViewDataPtr InRowData, bool bToggle, bool bExtend)
+{
+	if (!InRowData || !CellsListView.IsValid() || !SelectedRowMask.IsValidIndex(InRowData->CellIndex))
+	{
+		return false;
+	}
+
+	const int32 RowIndex = InRowData->CellIndex;
+	const int32 AnchorVisibleIndex = bExtend && VisibleRowIndices.IsValidIndex(SelectionAnchorRowIndex)
+		? VisibleRowIndices[SelectionAnchorRowIndex]
+		: INDEX_NONE;
+
+	FEasyDataTableEditorRowListViewDataPtr NewHighlightedRow = InRowData;
+	if (AnchorVisibleIndex != INDEX_NONE && VisibleRowIndices.IsValidIndex(RowIndex))
+	{
+		SelectedRowMask.Init(false, AvailableRows.Num());
+		SelectVisibleRowRange(AnchorVisibleIndex, VisibleRowIndices[RowIndex]);
+	}
+	else if (bToggle)
+	{
+		SelectedRowMask[RowIndex] = !SelectedRowMask[RowIndex];
+		SelectionAnchorRowIndex = RowIndex;
+
+		// The highlighted row is always selected: keep it if it still is, otherwise move it to a row that is
+		if (!SelectedRowMask[RowIndex])
+		{
+			const int32 HighlightedRowIndex = VisibleRows.IsValidIndex(HighlightedVisibleRowIndex) ? VisibleRows[HighlightedVisibleRowIndex]->CellIndex : INDEX_NONE;
+			const int32 NewHighlightedRowIndex = (HighlightedRowIndex != INDEX_NONE && SelectedRowMask[HighlightedRowIndex]) ? HighlightedRowIndex : SelectedRowMask.Find(true);
+			NewHighlightedRow = AvailableRows.IsValidIndex(NewHighlightedRowIndex) ? AvailableRows[NewHighlightedRowIndex] : nullptr;
+		}
+	}
+	else
+	{
+		return false;
+	}
+	NotifySelectedRowsChanged();
+
+	// A direct selection only moves the highlight in OnRowSelectionChanged, the mask is already up to date
+	if (NewHighlightedRow)
+	{
+		CellsListView->SetSelection(NewHighlightedRow, ESelectInfo::Direct);
+	}
+	else
+	{
+		CellsListView->ClearSelection();
 	}
+	return true;
 }
 
 void FEasyDataTableEditor::CopySelectedRow()
@@ -939,22 +1944,24 @@ void FEasyDataTableEditor::RenameSelectedRowCommand()
 		return;
 	}
 
-	if (VisibleRows.IsValidIndex(HighlightedVisibleRowIndex))
+	if (CellsListView.IsValid() && VisibleRows.IsValidIndex(HighlightedVisibleRowIndex))
 	{
 		TSharedPtr< SEasyDataTableListViewRow > RowWidget = StaticCastSharedPtr< SEasyDataTableListViewRow >(CellsListView->WidgetFromItem(VisibleRows[HighlightedVisibleRowIndex]));
-		RowWidget->SetRowForRename();
+		if (RowWidget.IsValid())
+		{
+			RowWidget->SetRowForRename();
+		}
 	}
 }
 
 void FEasyDataTableEditor::DeleteSelectedRow()
 {
+	FlushDeferredModelChange();
+
 	if (UDataTable* Table = GetEditableDataTable())
 	{
 		// We must perform this before removing the row
-		const int32 RowToRemoveIndex = VisibleRows.IndexOfByPredicate([&](const FEasyDataTableEditorRowListViewDataPtr& InRowName) -> bool
-		{
-			return InRowName->RowId == HighlightedRowName;
-		});
+		const int32 RowToRemoveIndex = FindVisibleRowIndex(HighlightedRowName);
 		// Remove row
 		if (FEasyDataTableEditorUtils::RemoveRow(Table, HighlightedRowName))
 		{
@@ -966,7 +1973,7 @@ void FEasyDataTableEditor::DeleteSelectedRow()
 			}
 			// Refresh list. Otherwise, the removed row would still appear in the screen until the next list refresh. An
 			// analog of CellsListView->RequestListRefresh() also occurs inside FEasyDataTableEditorUtils::SelectRow
-			else
+			else if (CellsListView.IsValid())
 			{
 				CellsListView->RequestListRefresh();
 			}
@@ -983,6 +1990,7 @@ void FEasyDataTableEditor::OnFilterTextChanged(const FText& InFilterText)
 {
 	ActiveFilterText = InFilterText;
 	UpdateVisibleRows();
+	SaveLayoutData();
 }
 
 void FEasyDataTableEditor::OnFilterTextCommitted(const FText& NewText, ETextCommit::Type CommitInfo)
@@ -1060,9 +2068,51 @@ FReply FEasyDataTableEditor::OnFindRowInContentBrowserClicked()
 void FEasyDataTableEditor::RefreshCachedDataTable(const FName InCachedSelection, const bool bUpdateEvenIfValid)
 {
 	UDataTable* Table = GetEditableDataTable();
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_RefreshCachedDataTable, Table ? Table->GetRowMap().Num() : 0, AvailableColumns.Num());
+
 	TArray<FEasyDataTableEditorColumnHeaderDataPtr> PreviousColumns = AvailableColumns;
 
-	FEasyDataTableEditorUtils::CacheDataTableForEditing(Table, AvailableColumns, AvailableRows);
+	// The cached rows are shared with every other editor of this table
+	if (!Model.IsValid() && Table)
+	{
+		Model = FEasyDataTableEditorModel::FindOrCreate(Table);
+		Model->SetCellMeasurer(FEasyDataTableSlateCellMeasurer::Get());
+		Model->OnModelChanged().AddSP(this, &FEasyDataTableEditor::HandleModelChanged);
+	}
+
+	FEasyDataTableEditorCacheTimings CacheTimings;
+	if (Model.IsValid())
+	{
+		Model->BuildIfNeeded();
+		AvailableColumns = Model->GetColumns();
+		AvailableRows = Model->GetRows();
+		CacheTimings = Model->GetLastCacheTimings();
+	}
+	else
+	{
+		AvailableColumns.Reset();
+		AvailableRows.Reset();
+	}
+
+	// The selection is indexed by slot, which only stays valid while slots keep their row
+	if (!Model.IsValid() || Model->DidLastBuildReassignRows())
+	{
+		SelectedRowMask.Init(false, AvailableRows.Num());
+		SelectionAnchorRowIndex = INDEX_NONE;
+	}
+	else
+	{
+		SelectedRowMask.SetNum(AvailableRows.Num(), false);
+	}
+
+	LastRefreshStats.CellTextSeconds = CacheTimings.CellTextSeconds;
+	LastRefreshStats.MeasureSeconds = CacheTimings.MeasureSeconds;
+	LastRefreshStats.WidgetGenerationSeconds = 0.0;
+	if (bShowPerformanceStats)
+	{
+		LastRefreshStats.CacheBytes = GetCachedDataAllocatedSize();
+	}
+	bPerformanceStatsTextDirty = true;
 
 	// Update the desired width of the row names and numbers column
 	// This prevents it growing or shrinking as you scroll the list view
@@ -1100,108 +2150,326 @@ void FEasyDataTableEditor::RefreshCachedDataTable(const FName InCachedSelection,
 
 	if (PreviousColumns != AvailableColumns)
 	{
-		ColumnNamesHeaderRow->ClearColumns();
+		RebuildColumnHeaders();
+	}
 
-		if (CanEditRows())
-		{
-			ColumnNamesHeaderRow->AddColumn(
-				SHeaderRow::Column(RowDragDropColumnId)
-				[
-					SNew(SBox)
-					.VAlign(VAlign_Fill)
-				.HAlign(HAlign_Fill)
-				.ToolTip(IDocumentation::Get()->CreateToolTip(
-					LOCTEXT("DataTableRowHandleTooltip", "Drag Drop Handles"),
-					nullptr,
-					*FEasyDataTableEditorUtils::VariableTypesTooltipDocLink,
-					TEXT("DataTableRowHandle")))
-				[
-					SNew(STextBlock)
-					.Text(FText::GetEmpty())
-				]
-				]
-			);
-		}	
+	if (bShowFacetPanel && FacetPanel.IsValid())
+	{
+		FacetPanel->Refresh(AvailableColumns);
+	}
+
+	UpdateVisibleRows(InCachedSelection, bUpdateEvenIfValid);
+
+	if (PropertyView.IsValid())
+	{
+		PropertyView->SetObject(Table);
+	}
+}
+
+void FEasyDataTableEditor::RebuildColumnHeaders()
+{
+	ColumnNamesHeaderRow->ClearColumns();
 
+	if (CanEditRows())
+	{
 		ColumnNamesHeaderRow->AddColumn(
-			SHeaderRow::Column(RowNumberColumnId)
-			.SortMode(this, &FEasyDataTableEditor::GetColumnSortMode, RowNumberColumnId)
-			.OnSort(this, &FEasyDataTableEditor::OnColumnNumberSortModeChanged)
-			.ManualWidth(this, &FEasyDataTableEditor::GetRowNumberColumnWidth)
-			.OnWidthChanged(this, &FEasyDataTableEditor::OnRowNumberColumnResized)
+			SHeaderRow::Column(RowDragDropColumnId)
 			[
 				SNew(SBox)
 				.VAlign(VAlign_Fill)
-				.HAlign(HAlign_Fill)
-				.ToolTip(IDocumentation::Get()->CreateToolTip(
-				LOCTEXT("DataTableRowIndexTooltip", "Row Index"),
+			.HAlign(HAlign_Fill)
+			.ToolTip(IDocumentation::Get()->CreateToolTip(
+				LOCTEXT("DataTableRowHandleTooltip", "Drag Drop Handles"),
 				nullptr,
 				*FEasyDataTableEditorUtils::VariableTypesTooltipDocLink,
-				TEXT("DataTableRowIndex")))
-				[
-					SNew(STextBlock)
-					.Text(FText::GetEmpty())
-				]
+				TEXT("DataTableRowHandle")))
+			[
+				SNew(STextBlock)
+				.Text(FText::GetEmpty())
+			]
 			]
-
 		);
+	}	
 
+	if (HasStructDefaults())
+	{
 		ColumnNamesHeaderRow->AddColumn(
-			SHeaderRow::Column(RowNameColumnId)
-			.DefaultLabel(LOCTEXT("DataTableRowName", "Row Name"))
-			.ManualWidth(this, &FEasyDataTableEditor::GetRowNameColumnWidth)
-			.OnWidthChanged(this, &FEasyDataTableEditor::OnRowNameColumnResized)
-			.SortMode(this, &FEasyDataTableEditor::GetColumnSortMode, RowNameColumnId)
-			.OnSort(this, &FEasyDataTableEditor::OnColumnNameSortModeChanged)
+			SHeaderRow::Column(RowModifiedColumnId)
+			.DefaultLabel(FText::GetEmpty())
+			.DefaultTooltip(LOCTEXT("DataTableRowModifiedTooltip", "Rows that differ from the struct defaults"))
+			.FixedWidth(20.0f)
 		);
+	}
 
-		for (int32 ColumnIndex = 0; ColumnIndex < AvailableColumns.Num(); ++ColumnIndex)
-		{
-			const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData = AvailableColumns[ColumnIndex];
-
-			ColumnNamesHeaderRow->AddColumn(
-				SHeaderRow::Column(ColumnData->ColumnId)
-				.DefaultLabel(ColumnData->DisplayName)
-				.ManualWidth(TAttribute<float>::Create(TAttribute<float>::FGetter::CreateSP(this, &FEasyDataTableEditor::GetColumnWidth, ColumnIndex)))
-				.OnWidthChanged(this, &FEasyDataTableEditor::OnColumnResized, ColumnIndex)
-				.SortMode(this, &FEasyDataTableEditor::GetColumnSortMode, ColumnData->ColumnId)
-				.OnSort(this, &FEasyDataTableEditor::OnColumnSortModeChanged)
+	ColumnNamesHeaderRow->AddColumn(
+		SHeaderRow::Column(RowNumberColumnId)
+		.SortMode(this, &FEasyDataTableEditor::GetColumnSortMode, RowNumberColumnId)
+		.OnSort(this, &FEasyDataTableEditor::OnColumnNumberSortModeChanged)
+		.ManualWidth(this, &FEasyDataTableEditor::GetRowNumberColumnWidth)
+		.OnWidthChanged(this, &FEasyDataTableEditor::OnRowNumberColumnResized)
+		[
+			SNew(SBox)
+			.VAlign(VAlign_Fill)
+			.HAlign(HAlign_Fill)
+			.ToolTip(IDocumentation::Get()->CreateToolTip(
+			LOCTEXT("DataTableRowIndexTooltip", "Row Index"),
+			nullptr,
+			*FEasyDataTableEditorUtils::VariableTypesTooltipDocLink,
+			TEXT("DataTableRowIndex")))
+			[
+				SNew(STextBlock)
+				.Text(FText::GetEmpty())
+			]
+		]
+
+	);
+
+	ColumnNamesHeaderRow->AddColumn(
+		SHeaderRow::Column(RowNameColumnId)
+		.DefaultLabel(LOCTEXT("DataTableRowName", "Row Name"))
+		.ManualWidth(this, &FEasyDataTableEditor::GetRowNameColumnWidth)
+		.OnWidthChanged(this, &FEasyDataTableEditor::OnRowNameColumnResized)
+		.SortMode(this, &FEasyDataTableEditor::GetColumnSortMode, RowNameColumnId)
+		.OnSort(this, &FEasyDataTableEditor::OnColumnNameSortModeChanged)
+	);
+
+	for (const int32 ColumnIndex : GetDisplayedColumnIndices())
+	{
+		const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData = AvailableColumns[ColumnIndex];
+
+		ColumnNamesHeaderRow->AddColumn(
+			SHeaderRow::Column(ColumnData->ColumnId)
+			.DefaultLabel(ColumnData->DisplayName)
+			.ManualWidth(TAttribute<float>::Create(TAttribute<float>::FGetter::CreateSP(this, &FEasyDataTableEditor::GetColumnWidth, ColumnIndex)))
+			.OnWidthChanged(this, &FEasyDataTableEditor::OnColumnResized, ColumnIndex)
+			.SortMode(this, &FEasyDataTableEditor::GetColumnSortMode, ColumnData->ColumnId)
+			.OnSort(this, &FEasyDataTableEditor::OnColumnSortModeChanged)
+			.OnGetMenuContent(FOnGetContent::CreateSP(this, &FEasyDataTableEditor::MakeColumnMenu, ColumnData->ColumnId))
+			[
+				SNew(SBox)
+				.Padding(FMargin(0, 4, 0, 4))
+				.VAlign(VAlign_Fill)
+				.ToolTip(IDocumentation::Get()->CreateToolTip(TAttribute<FText>::CreateSP(this, &FEasyDataTableEditor::GetColumnHeaderToolTipText, ColumnIndex), nullptr, *FEasyDataTableEditorUtils::VariableTypesTooltipDocLink, FEasyDataTableEditorUtils::GetRowTypeTooltipDocExcerptName(ColumnData)))
 				[
-					SNew(SBox)
-					.Padding(FMargin(0, 4, 0, 4))
-					.VAlign(VAlign_Fill)
-					.ToolTip(IDocumentation::Get()->CreateToolTip(FEasyDataTableEditorUtils::GetRowTypeInfoTooltipText(ColumnData), nullptr, *FEasyDataTableEditorUtils::VariableTypesTooltipDocLink, FEasyDataTableEditorUtils::GetRowTypeTooltipDocExcerptName(ColumnData)))
-					[
-						SNew(STextBlock)
-						.Justification(ETextJustify::Center)
-						.Text(ColumnData->DisplayName)
-					]
+					SNew(STextBlock)
+					.Justification(ETextJustify::Center)
+					.Text(ColumnData->DisplayName)
 				]
-			);
+			]
+		);
+	}
+}
+
+TArray<int32> FEasyDataTableEditor::GetDisplayedColumnIndices() const
+{
+	TArray<int32> ColumnIndices;
+	ColumnIndices.Reserve(AvailableColumns.Num());
+
+	// Columns named in the saved order come first, columns added to the struct since then follow in struct order
+	TBitArray<> PlacedColumns(false, AvailableColumns.Num());
+	for (const FName& ColumnId : ColumnOrder)
+	{
+		const int32 ColumnIndex = AvailableColumns.IndexOfByPredicate([ColumnId](const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData)
+		{
+			return ColumnData->ColumnId == ColumnId;
+		});
+		if (ColumnIndex != INDEX_NONE && !PlacedColumns[ColumnIndex])
+		{
+			PlacedColumns[ColumnIndex] = true;
+			ColumnIndices.Add(ColumnIndex);
+		}
+	}
+	for (int32 ColumnIndex = 0; ColumnIndex < AvailableColumns.Num(); ++ColumnIndex)
+	{
+		if (!PlacedColumns[ColumnIndex])
+		{
+			ColumnIndices.Add(ColumnIndex);
 		}
 	}
 
-	UpdateVisibleRows(InCachedSelection, bUpdateEvenIfValid);
+	ColumnIndices.RemoveAll([this](const int32 ColumnIndex)
+	{
+		return HiddenColumnIds.Contains(AvailableColumns[ColumnIndex]->ColumnId);
+	});
+	return ColumnIndices;
+}
+
+TSharedRef<SWidget> FEasyDataTableEditor::MakeColumnMenu(FName ColumnId)
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("MoveColumnLeft", "Move Column Left"),
+		FText::GetEmpty(),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &FEasyDataTableEditor::MoveColumn, ColumnId, -1),
+			FCanExecuteAction::CreateSP(this, &FEasyDataTableEditor::CanMoveColumn, ColumnId, -1)));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("MoveColumnRight", "Move Column Right"),
+		FText::GetEmpty(),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &FEasyDataTableEditor::MoveColumn, ColumnId, 1),
+			FCanExecuteAction::CreateSP(this, &FEasyDataTableEditor::CanMoveColumn, ColumnId, 1)));
+	MenuBuilder.AddMenuSeparator();
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("HideColumn", "Hide Column"),
+		FText::GetEmpty(),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &FEasyDataTableEditor::HideColumn, ColumnId)));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ShowAllColumns", "Show All Columns"),
+		FText::GetEmpty(),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &FEasyDataTableEditor::ShowAllColumns),
+			FCanExecuteAction::CreateLambda([this]() { return HiddenColumnIds.Num() > 0; })));
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("ResetColumnOrder", "Reset Column Order"),
+		FText::GetEmpty(),
+		FSlateIcon(),
+		FUIAction(
+			FExecuteAction::CreateSP(this, &FEasyDataTableEditor::ResetColumnOrder),
+			FCanExecuteAction::CreateLambda([this]() { return ColumnOrder.Num() > 0; })));
+	return MenuBuilder.MakeWidget();
+}
+
+void FEasyDataTableEditor::HideColumn(FName ColumnId)
+{
+	HiddenColumnIds.Add(ColumnId);
+	OnColumnLayoutChanged();
+}
+
+void FEasyDataTableEditor::ShowAllColumns()
+{
+	HiddenColumnIds.Reset();
+	OnColumnLayoutChanged();
+}
+
+void FEasyDataTableEditor::MoveColumn(FName ColumnId, int32 Direction)
+{
+	// Moves are relative to the displayed columns, hidden columns keep their place
+	TArray<int32> DisplayedColumnIndices = GetDisplayedColumnIndices();
+	const int32 Position = DisplayedColumnIndices.IndexOfByPredicate([this, ColumnId](const int32 ColumnIndex)
+	{
+		return AvailableColumns[ColumnIndex]->ColumnId == ColumnId;
+	});
+	if (!DisplayedColumnIndices.IsValidIndex(Position) || !DisplayedColumnIndices.IsValidIndex(Position + Direction))
+	{
+		return;
+	}
+	DisplayedColumnIndices.Swap(Position, Position + Direction);
 
-	if (PropertyView.IsValid())
+	TArray<FName> NewColumnOrder;
+	NewColumnOrder.Reserve(DisplayedColumnIndices.Num() + HiddenColumnIds.Num());
+	for (const int32 ColumnIndex : DisplayedColumnIndices)
 	{
-		PropertyView->SetObject(Table);
+		NewColumnOrder.Add(AvailableColumns[ColumnIndex]->ColumnId);
+	}
+	for (const FName& OrderedColumnId : ColumnOrder)
+	{
+		if (HiddenColumnIds.Contains(OrderedColumnId))
+		{
+			NewColumnOrder.Add(OrderedColumnId);
+		}
+	}
+	ColumnOrder = MoveTemp(NewColumnOrder);
+	OnColumnLayoutChanged();
+}
+
+bool FEasyDataTableEditor::CanMoveColumn(FName ColumnId, int32 Direction) const
+{
+	const TArray<int32> DisplayedColumnIndices = GetDisplayedColumnIndices();
+	const int32 Position = DisplayedColumnIndices.IndexOfByPredicate([this, ColumnId](const int32 ColumnIndex)
+	{
+		return AvailableColumns[ColumnIndex]->ColumnId == ColumnId;
+	});
+	return DisplayedColumnIndices.IsValidIndex(Position) && DisplayedColumnIndices.IsValidIndex(Position + Direction);
+}
+
+void FEasyDataTableEditor::ResetColumnOrder()
+{
+	ColumnOrder.Reset();
+	OnColumnLayoutChanged();
+}
+
+void FEasyDataTableEditor::OnColumnLayoutChanged()
+{
+	RebuildColumnHeaders();
+	CellsListView->RebuildList();
+	SaveLayoutData();
+}
+
+void FEasyDataTableEditor::ApplySort()
+{
+	if (SortByColumn == RowNumberColumnId)
+	{
+		OnColumnNumberSortModeChanged(EColumnSortPriority::Primary, SortByColumn, SortMode);
+	}
+	else if (SortByColumn == RowNameColumnId)
+	{
+		OnColumnNameSortModeChanged(EColumnSortPriority::Primary, SortByColumn, SortMode);
+	}
+	else
+	{
+		OnColumnSortModeChanged(EColumnSortPriority::Primary, SortByColumn, SortMode);
 	}
 }
 
 void FEasyDataTableEditor::UpdateVisibleRows(const FName InCachedSelection, const bool bUpdateEvenIfValid)
 {
-	if (ActiveFilterText.IsEmptyOrWhitespace())
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_UpdateVisibleRows, AvailableRows.Num(), AvailableColumns.Num());
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Indices);
+	const double FilterStartTime = FPlatformTime::Seconds();
+
+	// Rows passing the checked facet values, combined with the text filter below
+	TBitArray<> FacetRowMask;
+	const bool bUseFacets = bShowFacetPanel && FacetPanel.IsValid() && FacetPanel->BuildRowMask(AvailableColumns, AvailableRows.Num(), FacetRowMask);
+
+	if (ActiveFilterText.IsEmptyOrWhitespace() && !bUseFacets)
 	{
 		VisibleRows = AvailableRows;
 	}
+	else if (ActiveFilterText.IsEmptyOrWhitespace())
+	{
+		VisibleRows.Empty(AvailableRows.Num());
+		for (const FEasyDataTableEditorRowListViewDataPtr& RowData : AvailableRows)
+		{
+			if (FacetRowMask[RowData->CellIndex])
+			{
+				VisibleRows.Add(RowData);
+			}
+		}
+	}
 	else
 	{
 		VisibleRows.Empty(AvailableRows.Num());
 
 		const FString& ActiveFilterString = ActiveFilterText.ToString();
+
+		// Test each distinct cell string once, rows then only look up their cell IDs
+		TArray<TBitArray<>> MatchingCellIds;
+		MatchingCellIds.SetNum(AvailableColumns.Num());
+		for (int32 ColumnIndex = 0; ColumnIndex < AvailableColumns.Num(); ++ColumnIndex)
+		{
+			const TArray<FString>& CellStrings = AvailableColumns[ColumnIndex]->CellStrings;
+			MatchingCellIds[ColumnIndex].Init(false, CellStrings.Num());
+			for (int32 CellId = 0; CellId < CellStrings.Num(); ++CellId)
+			{
+				if (CellStrings[CellId].Contains(ActiveFilterString))
+				{
+					MatchingCellIds[ColumnIndex][CellId] = true;
+				}
+			}
+		}
+
 		for (const FEasyDataTableEditorRowListViewDataPtr& RowData : AvailableRows)
 		{
+			if (bUseFacets && !FacetRowMask[RowData->CellIndex])
+			{
+				continue;
+			}
+
 			bool bPassesFilter = false;
 
 			if (RowData->DisplayName.ToString().Contains(ActiveFilterString))
@@ -1210,9 +2478,10 @@ void FEasyDataTableEditor::UpdateVisibleRows(const FName InCachedSelection, cons
 			}
 			else
 			{
-				for (const FText& CellText : RowData->CellData)
+				for (int32 ColumnIndex = 0; ColumnIndex < AvailableColumns.Num(); ++ColumnIndex)
 				{
-					if (CellText.ToString().Contains(ActiveFilterString))
+					const TArray<uint32>& RowCellIds = AvailableColumns[ColumnIndex]->RowCellIds;
+					if (RowCellIds.IsValidIndex(RowData->CellIndex) && MatchingCellIds[ColumnIndex][RowCellIds[RowData->CellIndex]])
 					{
 						bPassesFilter = true;
 						break;
@@ -1227,6 +2496,20 @@ void FEasyDataTableEditor::UpdateVisibleRows(const FName InCachedSelection, cons
 		}
 	}
 
+	// Rows hidden by the filter leave the selection so batch edits never reach rows that are not shown
+	VisibleRowMask.Init(false, AvailableRows.Num());
+	for (const FEasyDataTableEditorRowListViewDataPtr& RowData : VisibleRows)
+	{
+		VisibleRowMask[RowData->CellIndex] = true;
+	}
+	SelectedRowMask.SetNum(AvailableRows.Num(), false);
+	SelectedRowMask.CombineWithBitwiseAND(VisibleRowMask, EBitwiseOperatorFlags::MaintainSize);
+
+	RebuildVisibleRowIndices();
+
+	LastRefreshStats.FilterSeconds = FPlatformTime::Seconds() - FilterStartTime;
+	bPerformanceStatsTextDirty = true;
+
 	CellsListView->RequestListRefresh();
 	RestoreCachedSelection(InCachedSelection, bUpdateEvenIfValid);
 }
@@ -1234,14 +2517,7 @@ void FEasyDataTableEditor::UpdateVisibleRows(const FName InCachedSelection, cons
 void FEasyDataTableEditor::RestoreCachedSelection(const FName InCachedSelection, const bool bUpdateEvenIfValid)
 {
 	// Validate the requested selection to see if it matches a known row
-	bool bSelectedRowIsValid = false;
-	if (!InCachedSelection.IsNone())
-	{
-		bSelectedRowIsValid = VisibleRows.ContainsByPredicate([&InCachedSelection](const FEasyDataTableEditorRowListViewDataPtr& RowData) -> bool
-		{
-			return RowData->RowId == InCachedSelection;
-		});
-	}
+	const bool bSelectedRowIsValid = FindVisibleRowIndex(InCachedSelection) != INDEX_NONE;
 
 	// Apply the new selection (if required)
 	if (!bSelectedRowIsValid)
@@ -1254,10 +2530,42 @@ void FEasyDataTableEditor::RestoreCachedSelection(const FName InCachedSelection,
 		SetHighlightedRow(InCachedSelection);
 		CallbackOnRowHighlighted.ExecuteIfBound(HighlightedRowName);
 	}
+
+	// The highlighted row is always part of the selection
+	if (VisibleRows.IsValidIndex(HighlightedVisibleRowIndex) && !HasSelectedRows())
+	{
+		SelectionAnchorRowIndex = VisibleRows[HighlightedVisibleRowIndex]->CellIndex;
+		SelectedRowMask[SelectionAnchorRowIndex] = true;
+	}
+	NotifySelectedRowsChanged();
+}
+
+void FEasyDataTableEditor::RebuildVisibleRowIndices()
+{
+	VisibleRowIndices.Init(INDEX_NONE, AvailableRows.Num());
+	for (int32 VisibleIndex = 0; VisibleIndex < VisibleRows.Num(); ++VisibleIndex)
+	{
+		VisibleRowIndices[VisibleRows[VisibleIndex]->CellIndex] = VisibleIndex;
+	}
+
+	HighlightedVisibleRowIndex = FindVisibleRowIndex(HighlightedRowName);
+}
+
+int32 FEasyDataTableEditor::FindVisibleRowIndex(FName RowId) const
+{
+	if (RowId.IsNone() || !Model.IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 RowIndex = Model->FindRowIndex(RowId);
+	return VisibleRowIndices.IsValidIndex(RowIndex) ? VisibleRowIndices[RowIndex] : INDEX_NONE;
 }
 
 TSharedRef<SVerticalBox> FEasyDataTableEditor::CreateContentBox()
 {
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Widgets);
+
 	TSharedRef<SScrollBar> HorizontalScrollBar = SNew(SScrollBar)
 		.Orientation(Orient_Horizontal)
 		.Thickness(FVector2D(12.0f, 12.0f));
@@ -1273,13 +2581,27 @@ TSharedRef<SVerticalBox> FEasyDataTableEditor::CreateContentBox()
 		.HeaderRow(ColumnNamesHeaderRow)
 		.OnGenerateRow(this, &FEasyDataTableEditor::MakeRowWidget)
 		.OnSelectionChanged(this, &FEasyDataTableEditor::OnRowSelectionChanged)
+		.OnItemScrolledIntoView(this, &FEasyDataTableEditor::OnItemScrolledIntoView)
 		.ExternalScrollbar(VerticalScrollBar)
 		.ConsumeMouseWheel(EConsumeMouseWheel::Always)
-		.SelectionMode(ESelectionMode::Type::Multi)
+		.SelectionMode(ESelectionMode::Type::Single)
 		.AllowOverscroll(EAllowOverscroll::No);
 	
+	SAssignNew(FacetPanel, SEasyDataTableFacetPanel)
+		.OnFacetsChanged(FSimpleDelegate::CreateSP(this, &FEasyDataTableEditor::OnFacetsChanged));
+
 	LoadLayoutData();
-	RefreshCachedDataTable();
+
+	// The row editor may have highlighted a row before the grid existed
+	const FName CachedSelection = HighlightedRowName;
+	HighlightedRowName = NAME_None;
+	RefreshCachedDataTable(CachedSelection, !CachedSelection.IsNone());
+
+	// Restore the sort saved with the layout
+	if (!SortByColumn.IsNone())
+	{
+		ApplySort();
+	}
 
 	return SNew(SVerticalBox)
 		+ SVerticalBox::Slot()
@@ -1295,9 +2617,42 @@ TSharedRef<SVerticalBox> FEasyDataTableEditor::CreateContentBox()
 			]
 		]
 		+SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.0f, 2.0f)
+		[
+			SNew(SHorizontalBox)
+			.Visibility(this, &FEasyDataTableEditor::GetCacheProgressVisibility)
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(4.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+				.Text(this, &FEasyDataTableEditor::GetCacheProgressText)
+			]
+			+SHorizontalBox::Slot()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SProgressBar)
+				.Percent(this, &FEasyDataTableEditor::GetCacheProgressPercent)
+			]
+		]
+		+SVerticalBox::Slot()
 		[
 			SNew(SHorizontalBox)
 			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.0f, 0.0f, 2.0f, 0.0f)
+			[
+				SNew(SBox)
+				.WidthOverride(220.0f)
+				.Visibility(this, &FEasyDataTableEditor::GetFacetPanelVisibility)
+				[
+					FacetPanel.ToSharedRef()
+				]
+			]
+			+SHorizontalBox::Slot()
 			[
 				SNew(SScrollBox)
 				.Orientation(Orient_Horizontal)
@@ -1321,11 +2676,69 @@ TSharedRef<SVerticalBox> FEasyDataTableEditor::CreateContentBox()
 			[
 				HorizontalScrollBar
 			]
+		]
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SBorder)
+			.Visibility(this, &FEasyDataTableEditor::GetPerformanceStatsVisibility)
+			.BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
+			.Padding(FMargin(6.0f, 2.0f))
+			[
+				SNew(STextBlock)
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+				.Text(this, &FEasyDataTableEditor::GetPerformanceStatsText)
+			]
 		];
 }
 
+TSharedRef<SWidget> FEasyDataTableEditor::CreateDataTableTabWidget()
+{
+	if (!DataTableTabWidget.IsValid())
+	{
+		DataTableTabWidget = CreateContentBox();
+		MemoryPolicyTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FEasyDataTableEditor::HandleMemoryPolicyTicker),
+			EasyDataTableEditor::MemoryPolicyTickSeconds);
+	}
+	return DataTableTabWidget.ToSharedRef();
+}
+
+TSharedRef<SWidget> FEasyDataTableEditor::CreateDataTableDetailsWidget()
+{
+	if (!PropertyView.IsValid())
+	{
+		FPropertyEditorModule& EditModule = FModuleManager::Get().GetModuleChecked<FPropertyEditorModule>("PropertyEditor");
+		FDetailsViewArgs DetailsViewArgs;
+		DetailsViewArgs.NameAreaSettings = FDetailsViewArgs::HideNameArea;
+		DetailsViewArgs.bHideSelectionTip = true;
+		PropertyView = EditModule.CreateDetailView(DetailsViewArgs);
+	}
+
+	PropertyView->SetObject(GetEditableDataTable());
+	return PropertyView.ToSharedRef();
+}
+
+TSharedRef<SWidget> FEasyDataTableEditor::CreateRowEditorTabWidget()
+{
+	if (!RowEditorTabWidget.IsValid())
+	{
+		RowEditorTabWidget = CreateRowEditorBox();
+
+		// Catch up with the rows highlighted and selected before the row editor existed
+		if (!HighlightedRowName.IsNone())
+		{
+			CallbackOnRowHighlighted.ExecuteIfBound(HighlightedRowName);
+		}
+		NotifySelectedRowsChanged();
+	}
+	return RowEditorTabWidget.ToSharedRef();
+}
+
 TSharedRef<SWidget> FEasyDataTableEditor::CreateRowEditorBox()
 {
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Widgets);
+
 	UDataTable* Table = Cast<UDataTable>(GetEditingObject());
 
 	// Support undo/redo
@@ -1338,6 +2751,7 @@ TSharedRef<SWidget> FEasyDataTableEditor::CreateRowEditorBox()
 	RowEditor->RowSelectedCallback.BindSP(this, &FEasyDataTableEditor::SetHighlightedRow);
 	CallbackOnRowHighlighted.BindSP(RowEditor, &SEasyRowEditor::SelectRow);
 	CallbackOnDataTableUndoRedo.BindSP(RowEditor, &SEasyRowEditor::HandleUndoRedo);
+	CallbackOnSelectedRowsChanged.BindSP(RowEditor, &SEasyRowEditor::HandleSelectedRowsChanged);
 	return RowEditor;
 }
 
@@ -1360,7 +2774,8 @@ TSharedRef<SDockTab> FEasyDataTableEditor::SpawnTab_RowEditor(const FSpawnTabArg
 			.HAlign(HAlign_Fill)
 			.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
 			[
-				RowEditorTabWidget.ToSharedRef()
+				SNew(SEasyDataTableLazyContent)
+				.OnCreateContent(this, &FEasyDataTableEditor::CreateRowEditorTabWidget)
 			]
 		];
 }
@@ -1378,7 +2793,7 @@ TSharedRef<SDockTab> FEasyDataTableEditor::SpawnTab_DataTable( const FSpawnTabAr
 		Table->SetFlags(RF_Transactional);
 	}
 
-	return SNew(SDockTab)
+	TSharedRef<SDockTab> Tab = SNew(SDockTab)
 		.Label( LOCTEXT("DataTableTitle", "Data Table") )
 		.TabColorScale( GetTabColorScale() )
 		[
@@ -1386,17 +2801,19 @@ TSharedRef<SDockTab> FEasyDataTableEditor::SpawnTab_DataTable( const FSpawnTabAr
 			.Padding(2)
 			.BorderImage( FAppStyle::GetBrush( "ToolPanel.GroupBorder" ) )
 			[
-				DataTableTabWidget.ToSharedRef()
+				SNew(SEasyDataTableLazyContent)
+				.OnCreateContent(this, &FEasyDataTableEditor::CreateDataTableTabWidget)
 			]
 		];
+
+	DataTableTab = Tab;
+	return Tab;
 }
 
 TSharedRef<SDockTab> FEasyDataTableEditor::SpawnTab_DataTableDetails(const FSpawnTabArgs& Args)
 {
 	check(Args.GetTabId().TabType == DataTableDetailsTabId);
 
-	PropertyView->SetObject(GetEditableDataTable());
-
 	return SNew(SDockTab)
 		.Label(LOCTEXT("DataTableDetails", "Data Table Details"))
 		.TabColorScale(GetTabColorScale())
@@ -1405,18 +2822,29 @@ TSharedRef<SDockTab> FEasyDataTableEditor::SpawnTab_DataTableDetails(const FSpaw
 			.Padding(2)
 			.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
 			[
-				PropertyView.ToSharedRef()
+				SNew(SEasyDataTableLazyContent)
+				.OnCreateContent(this, &FEasyDataTableEditor::CreateDataTableDetailsWidget)
 			]
 		];
 }
 
 void FEasyDataTableEditor::SetHighlightedRow(FName Name)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_SetHighlightedRow, VisibleRows.Num(), AvailableColumns.Num());
+
 	if (Name == HighlightedRowName)
 	{
 		return;
 	}
 
+	// The grid finds the row when it is created or catches up
+	if (!CellsListView.IsValid() || bModelChangeDeferred)
+	{
+		HighlightedRowName = Name;
+		HighlightedVisibleRowIndex = INDEX_NONE;
+		return;
+	}
+
 	if (Name.IsNone())
 	{
 		HighlightedRowName = NAME_None;
@@ -1426,26 +2854,12 @@ void FEasyDataTableEditor::SetHighlightedRow(FName Name)
 	else
 	{
 		HighlightedRowName = Name;
-
-		FEasyDataTableEditorRowListViewDataPtr* NewSelectionPtr = NULL;
-		for (HighlightedVisibleRowIndex = 0; HighlightedVisibleRowIndex < VisibleRows.Num(); ++HighlightedVisibleRowIndex)
-		{
-			if (VisibleRows[HighlightedVisibleRowIndex]->RowId == Name)
-			{
-				NewSelectionPtr = &(VisibleRows[HighlightedVisibleRowIndex]);
-
-				break;
-			}
-		}
-
+		HighlightedVisibleRowIndex = FindVisibleRowIndex(Name);
 
 		// Synchronize the list views
-		if (NewSelectionPtr)
+		if (VisibleRows.IsValidIndex(HighlightedVisibleRowIndex))
 		{
-			//修改后的高光
-			//CellsListView->SetItemSelection(*NewSelectionPtr,true);//->SetSelection(*NewSelectionPtr);
-			//CellsListView->SetItemHighlighted(*NewSelectionPtr,true);
-			CellsListView->RequestScrollIntoView(*NewSelectionPtr);
+			CellsListView->RequestScrollIntoView(VisibleRows[HighlightedVisibleRowIndex]);
 		}
 		else
 		{
@@ -4,19 +4,25 @@
 
 #include "ContentBrowserMenuContexts.h"
 #include "EasyCompositeDataTableEditor.h"
+#include "EasyDataTableCellCache.h"
 #include "EasyDataTableEditor.h"
+#include "EasyDataTableLayoutStore.h"
 #include "Engine/CompositeDataTable.h"
 
 #define LOCTEXT_NAMESPACE "FEasyDataTableEditorModule"
 const FName FEasyDataTableEditorModule::DataTableEditorAppIdentifier( TEXT( "EasyDataTableEditorApp" ) );
 void FEasyDataTableEditorModule::StartupModule()
 {
+	FEasyDataTableLayoutStore::Get().Initialize();
+	FEasyDataTableCellCache::PruneFiles();
 	BuildAssetMenu();
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 }
 
 void FEasyDataTableEditorModule::ShutdownModule()
 {
+	FEasyDataTableLayoutStore::Get().Shutdown();
+
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 }
@@ -0,0 +1,50 @@
+#include "EasyDataTableEditorStats.h"
+
+UE_TRACE_CHANNEL_DEFINE(EasyDataTableEditorChannel);
+
+DEFINE_STAT(STAT_EasyDataTable_RefreshCachedDataTable);
+DEFINE_STAT(STAT_EasyDataTable_UpdateVisibleRows);
+DEFINE_STAT(STAT_EasyDataTable_SortByColumn);
+DEFINE_STAT(STAT_EasyDataTable_SortByRowNumber);
+DEFINE_STAT(STAT_EasyDataTable_SortByRowName);
+DEFINE_STAT(STAT_EasyDataTable_SetHighlightedRow);
+DEFINE_STAT(STAT_EasyDataTable_MakeRowWidget);
+
+DEFINE_STAT(STAT_EasyDataTable_CacheDataForEditing);
+DEFINE_STAT(STAT_EasyDataTable_CacheRows);
+DEFINE_STAT(STAT_EasyDataTable_RemoveRow);
+DEFINE_STAT(STAT_EasyDataTable_RemoveRows);
+DEFINE_STAT(STAT_EasyDataTable_AddRow);
+DEFINE_STAT(STAT_EasyDataTable_AddOrReplaceRows);
+DEFINE_STAT(STAT_EasyDataTable_AddRowAboveOrBelowSelection);
+DEFINE_STAT(STAT_EasyDataTable_DuplicateRow);
+DEFINE_STAT(STAT_EasyDataTable_RenameRow);
+DEFINE_STAT(STAT_EasyDataTable_RenameRows);
+DEFINE_STAT(STAT_EasyDataTable_MoveRow);
+DEFINE_STAT(STAT_EasyDataTable_SelectRow);
+DEFINE_STAT(STAT_EasyDataTable_DiffersFromDefault);
+DEFINE_STAT(STAT_EasyDataTable_ResetToDefault);
+DEFINE_STAT(STAT_EasyDataTable_SetCellValue);
+DEFINE_STAT(STAT_EasyDataTable_SetColumnValues);
+DEFINE_STAT(STAT_EasyDataTable_BroadcastPostRowsChange);
+
+LLM_DEFINE_TAG(EasyDataTableEditor);
+LLM_DEFINE_TAG(EasyDataTableEditor_CellCache, TEXT("CellCache"), TEXT("EasyDataTableEditor"));
+LLM_DEFINE_TAG(EasyDataTableEditor_Indices, TEXT("Indices"), TEXT("EasyDataTableEditor"));
+LLM_DEFINE_TAG(EasyDataTableEditor_RowViewModels, TEXT("RowViewModels"), TEXT("EasyDataTableEditor"));
+LLM_DEFINE_TAG(EasyDataTableEditor_Widgets, TEXT("Widgets"), TEXT("EasyDataTableEditor"));
+
+DEFINE_STAT(STAT_EasyDataTable_NumRows);
+DEFINE_STAT(STAT_EasyDataTable_NumColumns);
+
+TRACE_DECLARE_INT_COUNTER(EasyDataTableEditor_Rows, TEXT("EasyDataTableEditor/Rows"));
+TRACE_DECLARE_INT_COUNTER(EasyDataTableEditor_Columns, TEXT("EasyDataTableEditor/Columns"));
+
+void FEasyDataTableEditorStats::RecordCounts(int32 NumRows, int32 NumColumns)
+{
+	SET_DWORD_STAT(STAT_EasyDataTable_NumRows, NumRows);
+	SET_DWORD_STAT(STAT_EasyDataTable_NumColumns, NumColumns);
+
+	TRACE_COUNTER_SET(EasyDataTableEditor_Rows, NumRows);
+	TRACE_COUNTER_SET(EasyDataTableEditor_Columns, NumColumns);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/** Trace channel for the editor hot paths. Enable with -trace=cpu,EasyDataTableEditor */
+UE_TRACE_CHANNEL_EXTERN(EasyDataTableEditorChannel);
+
+DECLARE_STATS_GROUP(TEXT("EasyDataTableEditor"), STATGROUP_EasyDataTableEditor, STATCAT_Advanced);
+
+// Table editor
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RefreshCachedDataTable"), STAT_EasyDataTable_RefreshCachedDataTable, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateVisibleRows"), STAT_EasyDataTable_UpdateVisibleRows, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SortByColumn"), STAT_EasyDataTable_SortByColumn, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SortByRowNumber"), STAT_EasyDataTable_SortByRowNumber, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SortByRowName"), STAT_EasyDataTable_SortByRowName, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SetHighlightedRow"), STAT_EasyDataTable_SetHighlightedRow, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("MakeRowWidget"), STAT_EasyDataTable_MakeRowWidget, STATGROUP_EasyDataTableEditor, );
+
+// FEasyDataTableEditorUtils
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CacheDataForEditing"), STAT_EasyDataTable_CacheDataForEditing, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CacheRows"), STAT_EasyDataTable_CacheRows, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RemoveRow"), STAT_EasyDataTable_RemoveRow, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RemoveRows"), STAT_EasyDataTable_RemoveRows, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AddRow"), STAT_EasyDataTable_AddRow, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AddOrReplaceRows"), STAT_EasyDataTable_AddOrReplaceRows, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AddRowAboveOrBelowSelection"), STAT_EasyDataTable_AddRowAboveOrBelowSelection, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("DuplicateRow"), STAT_EasyDataTable_DuplicateRow, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RenameRow"), STAT_EasyDataTable_RenameRow, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RenameRows"), STAT_EasyDataTable_RenameRows, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("MoveRow"), STAT_EasyDataTable_MoveRow, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SelectRow"), STAT_EasyDataTable_SelectRow, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("DiffersFromDefault"), STAT_EasyDataTable_DiffersFromDefault, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ResetToDefault"), STAT_EasyDataTable_ResetToDefault, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SetCellValue"), STAT_EasyDataTable_SetCellValue, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SetColumnValues"), STAT_EasyDataTable_SetColumnValues, STATGROUP_EasyDataTableEditor, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("BroadcastPostRowsChange"), STAT_EasyDataTable_BroadcastPostRowsChange, STATGROUP_EasyDataTableEditor, );
+
+// Low level memory tags, reported under EasyDataTableEditor when running with -llm
+LLM_DECLARE_TAG(EasyDataTableEditor);
+LLM_DECLARE_TAG(EasyDataTableEditor_CellCache);
+LLM_DECLARE_TAG(EasyDataTableEditor_Indices);
+LLM_DECLARE_TAG(EasyDataTableEditor_RowViewModels);
+LLM_DECLARE_TAG(EasyDataTableEditor_Widgets);
+
+// Size of the last table that went through a scoped counter
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rows"), STAT_EasyDataTable_NumRows, STATGROUP_EasyDataTableEditor, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Columns"), STAT_EasyDataTable_NumColumns, STATGROUP_EasyDataTableEditor, );
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(EasyDataTableEditor_Rows);
+TRACE_DECLARE_INT_COUNTER_EXTERN(EasyDataTableEditor_Columns);
+
+struct FEasyDataTableEditorStats
+{
+	/** Publishes the table dimensions to the stat group and the trace counters */
+	static void RecordCounts(int32 NumRows, int32 NumColumns);
+};
+
+/** True if anyone reads the table dimensions, so the arguments of the scoped counter are only evaluated then */
+#if STATS
+#define EASYDATATABLE_SHOULD_RECORD_COUNTS() (FThreadStats::IsCollectingData() || UE_TRACE_CHANNELEXPR_IS_ENABLED(EasyDataTableEditorChannel))
+#else
+#define EASYDATATABLE_SHOULD_RECORD_COUNTS() UE_TRACE_CHANNELEXPR_IS_ENABLED(EasyDataTableEditorChannel)
+#endif
+
+/**
+ * Scoped cycle counter for the editor hot paths.
+ * Also opens a trace scope named after the stat on EasyDataTableEditorChannel. The row and column counts go to
+ * the counters above, and are only evaluated while stats are collected or the channel is enabled.
+ */
+#define EASYDATATABLE_SCOPE_CYCLE_COUNTER(Stat, NumRows, NumColumns) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#Stat, EasyDataTableEditorChannel); \
+	do \
+	{ \
+		if (EASYDATATABLE_SHOULD_RECORD_COUNTS()) \
+		{ \
+			FEasyDataTableEditorStats::RecordCounts((NumRows), (NumColumns)); \
+		} \
+	} while (0)
@@ -0,0 +1,253 @@
+#include "EasyDataTableCacheBuilder.h"
+
+#include "DataTableUtils.h"
+#include "EasyDataTableCellCache.h"
+#include "EasyDataTableCellMeasurer.h"
+#include "EasyDataTableEditorStats.h"
+
+namespace EasyDataTableCacheBuilder
+{
+	static constexpr float CellPadding = 10.0f;
+}
+
+FEasyDataTableCacheBuilder::FEasyDataTableCacheBuilder(const UScriptStruct* InRowStruct, const TMap<FName, uint8*>& InRowMap, FEasyDataTableEditorRowArena& InRowArena, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows, const IEasyDataTableCellMeasurer* InCellMeasurer, const FString& InPersistentCacheName)
+	: RowStruct(InRowStruct)
+	, RowMap(InRowMap)
+	, RowArena(InRowArena)
+	, Columns(OutAvailableColumns)
+	, Rows(OutAvailableRows)
+	, NumOldRows(OutAvailableRows.Num())
+	, CellMeasurer(InCellMeasurer)
+	, MinRowHeight(InCellMeasurer ? InCellMeasurer->GetMinRowHeight() : 0.0f)
+{
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_CellCache);
+
+	// Builds may span frames, during which an iterator into the row map would be invalidated by any change to it
+	RowSnapshot.Reserve(RowMap.Num());
+	for (const TPair<FName, uint8*>& Row : RowMap)
+	{
+		RowSnapshot.Emplace(Row.Key, Row.Value);
+	}
+
+	TArray<FEasyDataTableEditorColumnHeaderDataPtr> OldColumns = Columns;
+
+	// First build array of properties
+	for (TFieldIterator<const FProperty> It(RowStruct); It; ++It)
+	{
+		const FProperty* Prop = *It;
+		check(Prop);
+		if (!Prop->HasMetaData(FName(TEXT("HideFromDataTableEditorColumn"))))
+		{
+			StructProps.Add(Prop);
+		}
+	}
+
+	// Populate the column data
+	Columns.Reset(StructProps.Num());
+	for (int32 Index = 0; Index < StructProps.Num(); ++Index)
+	{
+		const FProperty* Prop = StructProps[Index];
+		const FText PropertyDisplayName = DataTableUtils::GetPropertyDisplayName(Prop, FName::NameToDisplayString(Prop->GetName(), Prop->IsA<FBoolProperty>()));
+
+		FEasyDataTableEditorColumnHeaderDataPtr CachedColumnData;
+
+		// If at all possible, attempt to reuse previous columns if their data has not changed
+		if (Index >= OldColumns.Num() || OldColumns[Index]->ColumnId != Prop->GetFName() || !OldColumns[Index]->DisplayName.EqualTo(PropertyDisplayName))
+		{
+			CachedColumnData = MakeShareable(new FEasyDataTableEditorColumnHeaderData());
+			CachedColumnData->ColumnId = Prop->GetFName();
+			CachedColumnData->DisplayName = PropertyDisplayName;
+			CachedColumnData->Property = Prop;
+		}
+		else
+		{
+			CachedColumnData = OldColumns[Index];
+
+			// Need to update property hard pointer in case it got reconstructed
+			CachedColumnData->Property = Prop;
+		}
+
+		CachedColumnData->DesiredColumnWidth = CellMeasurer ? static_cast<float>(CellMeasurer->Measure(CachedColumnData->DisplayName.ToString()).X + EasyDataTableCacheBuilder::CellPadding) : 0.0f;
+
+		Columns.Add(CachedColumnData);
+	}
+
+	// The persistent cache only pays off when opening the table; later refreshes reuse the rows kept in memory.
+	// Its cell sizes are those of the grid, a headless build would overwrite them with zeros
+	if (!InPersistentCacheName.IsEmpty() && NumOldRows == 0 && CellMeasurer)
+	{
+		PersistentCacheName = InPersistentCacheName;
+		LayoutHash = FEasyDataTableCellCache::HashLayout(RowStruct, StructProps, CellMeasurer->GetLayoutHash());
+		PersistentCache = FEasyDataTableCellCache::Load(PersistentCacheName, LayoutHash, StructProps.Num());
+		RowHashes.Reserve(RowMap.Num());
+		CellWidths.Reserve(RowMap.Num() * StructProps.Num());
+	}
+
+	CellFormatters.Reserve(StructProps.Num());
+	CellSizesById.SetNum(StructProps.Num());
+	for (int32 ColumnIndex = 0; ColumnIndex < StructProps.Num(); ++ColumnIndex)
+	{
+		CellFormatters.Emplace(StructProps[ColumnIndex]);
+		Columns[ColumnIndex]->ResetCells(RowMap.Num());
+	}
+
+	Rows.Reset(RowMap.Num());
+}
+
+FEasyDataTableCacheBuilder::~FEasyDataTableCacheBuilder() = default;
+
+bool FEasyDataTableCacheBuilder::MatchesRowMap() const
+{
+	if (RowMap.Num() != RowSnapshot.Num())
+	{
+		return false;
+	}
+
+	int32 Index = 0;
+	for (const TPair<FName, uint8*>& Row : RowMap)
+	{
+		if (Row.Key != RowSnapshot[Index].Key || Row.Value != RowSnapshot[Index].Value)
+		{
+			return false;
+		}
+		++Index;
+	}
+	return true;
+}
+
+bool FEasyDataTableCacheBuilder::BuildRows(int32 MaxRows)
+{
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_CacheRows, RowSnapshot.Num(), Columns.Num());
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_CellCache);
+
+	const bool bUsePersistentCache = !PersistentCacheName.IsEmpty();
+	TArray<FString> CachedCells;
+	TArray<float> CachedCellWidths;
+
+	// Populate the row data
+	const int32 EndRowIndex = FMath::Min(NumBuiltRows + MaxRows, RowSnapshot.Num());
+	for (; NumBuiltRows < EndRowIndex; ++NumBuiltRows)
+	{
+		const int32 Index = NumBuiltRows;
+		const FName RowId = RowSnapshot[Index].Key;
+		const uint8* RowData = RowSnapshot[Index].Value;
+		FText RowName = FText::FromName(RowId);
+		FEasyDataTableEditorRowListViewDataPtr CachedRowData = RowArena.GetRow(Index);
+
+		// Slots past the previous rows may hold rows from an older build
+		if (Index >= NumOldRows || CachedRowData->RowId != RowId || !CachedRowData->DisplayName.EqualTo(RowName))
+		{
+			bRowsReassigned |= Index < NumOldRows;
+			CachedRowData->RowId = RowId;
+			CachedRowData->DisplayName = RowName;
+		}
+
+		CachedRowData->DesiredRowHeight = MinRowHeight;
+		CachedRowData->RowNum = Index + 1;
+		CachedRowData->CellIndex = Index;
+
+		bool bReadFromPersistentCache = false;
+		if (bUsePersistentCache)
+		{
+			const uint64 RowHash = FEasyDataTableCellCache::HashRow(RowStruct, RowData);
+			RowHashes.Add(RowHash);
+
+			float CachedRowHeight = 0.0f;
+			if (PersistentCache && PersistentCache->ReadRow(RowId, RowHash, CachedCells, CachedCellWidths, CachedRowHeight))
+			{
+				bReadFromPersistentCache = true;
+				CachedRowData->DesiredRowHeight = CachedRowHeight;
+				for (int32 ColumnIndex = 0; ColumnIndex < StructProps.Num(); ++ColumnIndex)
+				{
+					bool bIsNewCell = false;
+					CellFormatters[ColumnIndex].AddCellString(*Columns[ColumnIndex], CachedCells[ColumnIndex], bIsNewCell);
+					if (bIsNewCell)
+					{
+						// Measured if a changed row uses the same string
+						CellSizesById[ColumnIndex].Add(FVector2D(-1.0));
+					}
+
+					FEasyDataTableEditorColumnHeaderData& CachedColumnData = *Columns[ColumnIndex];
+					CachedColumnData.DesiredColumnWidth = FMath::Max(CachedColumnData.DesiredColumnWidth, CachedCellWidths[ColumnIndex]);
+				}
+				CellWidths.Append(CachedCellWidths);
+			}
+			else
+			{
+				++NumPersistentCacheMisses;
+			}
+		}
+
+		// Rebuild cell data unless the row is unchanged since it was cached on disk
+		if (!bReadFromPersistentCache)
+		{
+			for (int32 ColumnIndex = 0; ColumnIndex < StructProps.Num(); ++ColumnIndex)
+			{
+				FEasyDataTableEditorColumnHeaderData& CachedColumnData = *Columns[ColumnIndex];
+
+				const uint64 CellTextStartCycles = FPlatformTime::Cycles64();
+
+				bool bIsNewCell = false;
+				const uint32 CellId = CellFormatters[ColumnIndex].AddCell(CachedColumnData, RowData, bIsNewCell);
+
+				const uint64 MeasureStartCycles = FPlatformTime::Cycles64();
+				CellTextCycles += MeasureStartCycles - CellTextStartCycles;
+
+				if (!CellMeasurer)
+				{
+					continue;
+				}
+
+				if (bIsNewCell)
+				{
+					CellSizesById[ColumnIndex].Add(FVector2D(-1.0));
+				}
+				FVector2D& CellTextSize = CellSizesById[ColumnIndex][CellId];
+				if (CellTextSize.X < 0.0)
+				{
+					CellTextSize = CellMeasurer->Measure(CachedColumnData.CellStrings[CellId]);
+				}
+
+				MeasureCycles += FPlatformTime::Cycles64() - MeasureStartCycles;
+
+				CachedRowData->DesiredRowHeight = static_cast<float>(FMath::Max(CachedRowData->DesiredRowHeight, CellTextSize.Y));
+
+				const float CellWidth = static_cast<float>(CellTextSize.X + EasyDataTableCacheBuilder::CellPadding);
+				CachedColumnData.DesiredColumnWidth = FMath::Max(CachedColumnData.DesiredColumnWidth, CellWidth);
+
+				if (bUsePersistentCache)
+				{
+					CellWidths.Add(CellWidth);
+				}
+			}
+		}
+
+		Rows.Add(CachedRowData);
+	}
+
+	return IsDone();
+}
+
+void FEasyDataTableCacheBuilder::Finish(FEasyDataTableEditorCacheTimings* OutTimings)
+{
+	check(IsDone());
+
+	if (!PersistentCacheName.IsEmpty())
+	{
+		// Release the mapping first, the file is about to be replaced
+		const bool bCacheMatchesTable = PersistentCache && NumPersistentCacheMisses == 0;
+		PersistentCache.Reset();
+
+		if (!bCacheMatchesTable)
+		{
+			FEasyDataTableCellCache::Save(PersistentCacheName, LayoutHash, Columns, Rows, RowHashes, CellWidths);
+		}
+		PersistentCacheName.Reset();
+	}
+
+	if (OutTimings)
+	{
+		OutTimings->CellTextSeconds = FPlatformTime::ToSeconds64(CellTextCycles);
+		OutTimings->MeasureSeconds = FPlatformTime::ToSeconds64(MeasureCycles);
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyDataTableCellFormatter.h"
+#include "EasyDataTableEditorUtils.h"
+
+class FEasyDataTableCellCache;
+class IEasyDataTableCellMeasurer;
+
+/**
+ * Incremental form of FEasyDataTableEditorUtils::CacheDataForEditing. The columns are set up on construction and
+ * the rows are cached in row map order by successive calls to BuildRows, so a large table can be cached over
+ * several frames while the rows built so far are already shown.
+ *
+ * Cell sizes come from the measurer given on construction; without one, nothing in the builder depends on Slate
+ * and the sizes stay 0. Formatting reads UObjects and the measurer may use the font cache, so every call must be made
+ * on the game thread. The rows to build are taken from the row map on construction; if the map changes before the
+ * last call to BuildRows (see MatchesRowMap), the builder must be dropped, as it may hold freed rows.
+ */
+class EASYDATATABLEEDITOR_API FEasyDataTableCacheBuilder
+{
+public:
+	/**
+	 * @param	RowArena				Storage of the rows, the Nth row of the table is always kept in the Nth slot
+	 * @param	OutAvailableColumns		Rebuilt on construction, reusing the columns that did not change
+	 * @param	OutAvailableRows		Emptied on construction, each call to BuildRows appends the rows it cached
+	 * @param	CellMeasurer			Sizes the columns and rows, may be null; must outlive the builder
+	 * @param	PersistentCacheName		If set, the first build reuses the cells stored on disk under this name for rows that did not change, and stores the result. Ignored without a measurer
+	 */
+	FEasyDataTableCacheBuilder(const UScriptStruct* InRowStruct, const TMap<FName, uint8*>& InRowMap, FEasyDataTableEditorRowArena& InRowArena, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows, const IEasyDataTableCellMeasurer* CellMeasurer, const FString& PersistentCacheName = FString());
+	~FEasyDataTableCacheBuilder();
+
+	/**
+	 * Caches up to MaxRows more rows and appends them to the rows
+	 *
+	 * @return	True once every row is cached
+	 */
+	bool BuildRows(int32 MaxRows);
+
+	/** Stores the persistent cache, called once after the last row is built */
+	void Finish(FEasyDataTableEditorCacheTimings* OutTimings = nullptr);
+
+	bool IsDone() const { return NumBuiltRows == RowSnapshot.Num(); }
+	int32 GetNumBuiltRows() const { return NumBuiltRows; }
+	int32 GetNumRows() const { return RowSnapshot.Num(); }
+
+	/** True if the row map still holds the rows it held on construction, in the same order. Walks every row */
+	bool MatchesRowMap() const;
+
+	/** True if a row that was in the rows before now holds a different row, so widgets made for it are stale */
+	bool DidReassignRows() const { return bRowsReassigned; }
+
+private:
+	const UScriptStruct* RowStruct;
+	const TMap<FName, uint8*>& RowMap;
+	FEasyDataTableEditorRowArena& RowArena;
+	TArray<FEasyDataTableEditorColumnHeaderDataPtr>& Columns;
+	TArray<FEasyDataTableEditorRowListViewDataPtr>& Rows;
+
+	/** Name and memory of every row on construction, in row map order */
+	TArray<TPair<FName, const uint8*>> RowSnapshot;
+	int32 NumBuiltRows = 0;
+	int32 NumOldRows = 0;
+	bool bRowsReassigned = false;
+
+	TArray<const FProperty*> StructProps;
+	const IEasyDataTableCellMeasurer* CellMeasurer;
+	float MinRowHeight = 0.0f;
+
+	/** Cells are interned per column so repeated values (enums, bools, names) are formatted, stored and measured once */
+	TArray<FEasyDataTableCellFormatter> CellFormatters;
+	TArray<TArray<FVector2D>> CellSizesById;
+
+	FString PersistentCacheName;
+	uint64 LayoutHash = 0;
+	TUniquePtr<FEasyDataTableCellCache> PersistentCache;
+	TArray<uint64> RowHashes;
+	TArray<float> CellWidths;
+	int32 NumPersistentCacheMisses = 0;
+
+	/** Cycle counts per stage, summed over every call to BuildRows */
+	uint64 CellTextCycles = 0;
+	uint64 MeasureCycles = 0;
+};
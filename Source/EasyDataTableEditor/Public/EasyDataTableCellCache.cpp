@@ -0,0 +1,420 @@
+#include "EasyDataTableCellCache.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Internationalization/Culture.h"
+#include "Internationalization/Internationalization.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/ArchiveUObject.h"
+
+struct FEasyDataTableCellCacheHeader
+{
+	uint32 Magic;
+	uint32 Version;
+	uint64 LayoutHash;
+	int32 NumColumns;
+	int32 NumRows;
+	uint64 StringsSize;
+};
+
+struct FEasyDataTableCellCacheRow
+{
+	uint64 RowHash;
+	uint32 NameOffset;
+	uint32 NameLength;
+	uint32 FirstCell;
+	float RowHeight;
+};
+
+struct FEasyDataTableCellCacheCell
+{
+	uint32 TextOffset;
+	uint32 TextLength;
+	float Width;
+};
+
+namespace EasyDataTableCellCache
+{
+	static constexpr uint32 Magic = 0x43544445; // 'EDTC'
+
+	/** Bump when the file format, the cell text or the way cells are measured changes */
+	static constexpr uint32 Version = 2;
+
+	/** Temporary files older than this are left over from an interrupted write */
+	static constexpr double MaxTempFileAgeSeconds = 24.0 * 60.0 * 60.0;
+
+	/** Feeds everything a row serializes into a hash, writing names and object references as stable strings */
+	class FRowHashWriter : public FArchiveUObject
+	{
+	public:
+		FRowHashWriter()
+		{
+			SetIsSaving(true);
+		}
+
+		virtual void Serialize(void* Data, int64 Num) override
+		{
+			Builder.Update(Data, Num);
+		}
+
+		virtual FArchive& operator<<(FName& Name) override
+		{
+			FString String = Name.ToString();
+			return *this << String;
+		}
+
+		virtual FArchive& operator<<(UObject*& Object) override
+		{
+			FString Path = Object ? Object->GetPathName() : FString();
+			return *this << Path;
+		}
+
+		using FArchiveUObject::operator<<;
+
+		virtual FString GetArchiveName() const override { return TEXT("EasyDataTableRowHashWriter"); }
+
+		uint64 GetHash()
+		{
+			return Builder.Finalize().Hash;
+		}
+
+	private:
+		FXxHash64Builder Builder;
+	};
+
+	static void UpdateHash(FXxHash64Builder& Builder, const FString& String)
+	{
+		Builder.Update(*String, String.Len() * sizeof(TCHAR));
+	}
+
+	template <typename T>
+	static void UpdateHash(FXxHash64Builder& Builder, const T& Value)
+	{
+		Builder.Update(&Value, sizeof(T));
+	}
+}
+
+FEasyDataTableCellCache::~FEasyDataTableCellCache()
+{
+	// The region must be released before the file it maps
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+uint64 FEasyDataTableCellCache::HashLayout(const UScriptStruct* RowStruct, TConstArrayView<const FProperty*> Columns, uint64 MeasurerHash)
+{
+	using namespace EasyDataTableCellCache;
+
+	FXxHash64Builder Builder;
+	UpdateHash(Builder, Version);
+	UpdateHash(Builder, RowStruct->GetPathName());
+	UpdateHash(Builder, RowStruct->GetStructureSize());
+	for (const FProperty* Column : Columns)
+	{
+		UpdateHash(Builder, Column->GetName());
+		UpdateHash(Builder, Column->GetCPPType());
+		UpdateHash(Builder, Column->GetOffset_ForInternal());
+		UpdateHash(Builder, Column->ArrayDim);
+	}
+
+	// Cell sizes depend on the measurer, cell text on the culture
+	UpdateHash(Builder, MeasurerHash);
+	UpdateHash(Builder, FInternationalization::Get().GetCurrentCulture()->GetName());
+
+	return Builder.Finalize().Hash;
+}
+
+uint64 FEasyDataTableCellCache::HashRow(const UScriptStruct* RowStruct, const uint8* RowData)
+{
+	EasyDataTableCellCache::FRowHashWriter Writer;
+	const_cast<UScriptStruct*>(RowStruct)->SerializeItem(Writer, const_cast<uint8*>(RowData), nullptr);
+	return Writer.GetHash();
+}
+
+TUniquePtr<FEasyDataTableCellCache> FEasyDataTableCellCache::Load(const FString& CacheName, uint64 LayoutHash, int32 NumColumns)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FEasyDataTableCellCache::Load);
+
+	const FString Filename = GetCacheFilename(CacheName);
+	if (!IFileManager::Get().FileExists(*Filename))
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FEasyDataTableCellCache> Cache(new FEasyDataTableCellCache());
+	Cache->MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	if (!Cache->MappedFile)
+	{
+		return nullptr;
+	}
+
+	const int64 FileSize = Cache->MappedFile->GetFileSize();
+	if (FileSize < (int64)sizeof(FEasyDataTableCellCacheHeader))
+	{
+		return nullptr;
+	}
+
+	Cache->MappedRegion.Reset(Cache->MappedFile->MapRegion(0, FileSize));
+	if (!Cache->MappedRegion)
+	{
+		return nullptr;
+	}
+
+	const uint8* Data = Cache->MappedRegion->GetMappedPtr();
+	const FEasyDataTableCellCacheHeader* Header = reinterpret_cast<const FEasyDataTableCellCacheHeader*>(Data);
+	if (Header->Magic != EasyDataTableCellCache::Magic
+		|| Header->Version != EasyDataTableCellCache::Version
+		|| Header->LayoutHash != LayoutHash
+		|| Header->NumColumns != NumColumns
+		|| Header->NumRows < 0)
+	{
+		return nullptr;
+	}
+
+	// Reject truncated files before handing out pointers into them
+	const int64 RowsOffset = sizeof(FEasyDataTableCellCacheHeader);
+	const int64 CellsOffset = RowsOffset + (int64)Header->NumRows * sizeof(FEasyDataTableCellCacheRow);
+	const int64 StringsOffset = CellsOffset + (int64)Header->NumRows * NumColumns * sizeof(FEasyDataTableCellCacheCell);
+	if (StringsOffset + (int64)Header->StringsSize != FileSize)
+	{
+		return nullptr;
+	}
+
+	Cache->Header = Header;
+	Cache->Rows = reinterpret_cast<const FEasyDataTableCellCacheRow*>(Data + RowsOffset);
+	Cache->Cells = reinterpret_cast<const FEasyDataTableCellCacheCell*>(Data + CellsOffset);
+	Cache->Strings = reinterpret_cast<const UTF8CHAR*>(Data + StringsOffset);
+
+	Cache->RowIndexByName.Reserve(Header->NumRows);
+	for (int32 RowIndex = 0; RowIndex < Header->NumRows; ++RowIndex)
+	{
+		const FEasyDataTableCellCacheRow& Row = Cache->Rows[RowIndex];
+		if ((uint64)Row.NameOffset + Row.NameLength > Header->StringsSize)
+		{
+			return nullptr;
+		}
+
+		// Rows that are not in the name table cannot be in the table either
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Cache->Strings + Row.NameOffset), Row.NameLength);
+		const FName RowName(Converted.Length(), Converted.Get(), FNAME_Find);
+		if (RowName != NAME_None)
+		{
+			Cache->RowIndexByName.Add(RowName, RowIndex);
+		}
+	}
+
+	return Cache;
+}
+
+void FEasyDataTableCellCache::Save(const FString& CacheName, uint64 LayoutHash, TConstArrayView<FEasyDataTableEditorColumnHeaderDataPtr> Columns, TConstArrayView<FEasyDataTableEditorRowListViewDataPtr> InRows, TConstArrayView<uint64> RowHashes, TConstArrayView<float> CellWidths)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FEasyDataTableCellCache::Save);
+
+	const int32 NumColumns = Columns.Num();
+
+	check(InRows.Num() == RowHashes.Num() && InRows.Num() * NumColumns == CellWidths.Num());
+
+	TArray<FEasyDataTableCellCacheRow> RowRecords;
+	TArray<FEasyDataTableCellCacheCell> CellRecords;
+	TArray<uint8> StringBlob;
+	RowRecords.Reserve(InRows.Num());
+	CellRecords.Reserve(CellWidths.Num());
+
+	auto AddString = [&StringBlob](const FString& String, uint32& OutOffset, uint32& OutLength)
+	{
+		const FTCHARToUTF8 Converted(*String, String.Len());
+		OutOffset = StringBlob.Num();
+		OutLength = Converted.Length();
+		StringBlob.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	};
+
+	// Interned cells share their text in the blob, keyed by column and cell ID
+	TArray<TArray<TPair<uint32, uint32>>> CellStringRanges;
+	CellStringRanges.SetNum(NumColumns);
+	for (int32 ColumnIndex = 0; ColumnIndex < NumColumns; ++ColumnIndex)
+	{
+		CellStringRanges[ColumnIndex].Init(TPair<uint32, uint32>(MAX_uint32, 0), Columns[ColumnIndex]->CellStrings.Num());
+	}
+
+	for (int32 RowIndex = 0; RowIndex < InRows.Num(); ++RowIndex)
+	{
+		const FEasyDataTableEditorRowListViewData& Row = *InRows[RowIndex];
+
+		FEasyDataTableCellCacheRow& RowRecord = RowRecords.AddDefaulted_GetRef();
+		RowRecord.RowHash = RowHashes[RowIndex];
+		RowRecord.FirstCell = CellRecords.Num();
+		RowRecord.RowHeight = Row.DesiredRowHeight;
+		AddString(Row.RowId.ToString(), RowRecord.NameOffset, RowRecord.NameLength);
+
+		for (int32 ColumnIndex = 0; ColumnIndex < NumColumns; ++ColumnIndex)
+		{
+			FEasyDataTableCellCacheCell& CellRecord = CellRecords.AddDefaulted_GetRef();
+			CellRecord.Width = CellWidths[RowIndex * NumColumns + ColumnIndex];
+
+			const FEasyDataTableEditorColumnHeaderData& Column = *Columns[ColumnIndex];
+			if (!Column.RowCellIds.IsValidIndex(Row.CellIndex))
+			{
+				return;
+			}
+
+			TPair<uint32, uint32>& StringRange = CellStringRanges[ColumnIndex][Column.RowCellIds[Row.CellIndex]];
+			if (StringRange.Key == MAX_uint32)
+			{
+				AddString(Column.GetCellString(Row.CellIndex), StringRange.Key, StringRange.Value);
+			}
+			CellRecord.TextOffset = StringRange.Key;
+			CellRecord.TextLength = StringRange.Value;
+		}
+	}
+
+	FEasyDataTableCellCacheHeader Header;
+	Header.Magic = EasyDataTableCellCache::Magic;
+	Header.Version = EasyDataTableCellCache::Version;
+	Header.LayoutHash = LayoutHash;
+	Header.NumColumns = NumColumns;
+	Header.NumRows = RowRecords.Num();
+	Header.StringsSize = StringBlob.Num();
+
+	TArray<uint8> FileData;
+	FileData.Reserve(sizeof(Header) + RowRecords.NumBytes() + CellRecords.NumBytes() + StringBlob.Num());
+	FileData.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+	FileData.Append(reinterpret_cast<const uint8*>(RowRecords.GetData()), RowRecords.NumBytes());
+	FileData.Append(reinterpret_cast<const uint8*>(CellRecords.GetData()), CellRecords.NumBytes());
+	FileData.Append(StringBlob);
+
+	// Write to a unique temporary file and move it over the cache, so a concurrent load never sees a partial file
+	Async(EAsyncExecution::ThreadPool, [Filename = GetCacheFilename(CacheName), FileData = MoveTemp(FileData)]()
+	{
+		const FString TempFilename = FPaths::CreateTempFilename(*FPaths::GetPath(Filename), TEXT("CellCache"), TEXT(".tmp"));
+		if (FFileHelper::SaveArrayToFile(FileData, *TempFilename))
+		{
+			if (!IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+			{
+				IFileManager::Get().Delete(*TempFilename);
+			}
+		}
+	});
+}
+
+bool FEasyDataTableCellCache::ReadRow(FName RowName, uint64 RowHash, TArray<FString>& OutCells, TArray<float>& OutCellWidths, float& OutRowHeight) const
+{
+	const int32* RowIndex = RowIndexByName.Find(RowName);
+	if (!RowIndex)
+	{
+		return false;
+	}
+
+	const FEasyDataTableCellCacheRow& Row = Rows[*RowIndex];
+	if (Row.RowHash != RowHash || (uint64)Row.FirstCell + Header->NumColumns > (uint64)Header->NumRows * Header->NumColumns)
+	{
+		return false;
+	}
+
+	OutCells.Reset(Header->NumColumns);
+	OutCellWidths.Reset(Header->NumColumns);
+	for (int32 ColumnIndex = 0; ColumnIndex < Header->NumColumns; ++ColumnIndex)
+	{
+		const FEasyDataTableCellCacheCell& Cell = Cells[Row.FirstCell + ColumnIndex];
+		if ((uint64)Cell.TextOffset + Cell.TextLength > Header->StringsSize)
+		{
+			return false;
+		}
+
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Strings + Cell.TextOffset), Cell.TextLength);
+		OutCells.Emplace(Converted.Length(), Converted.Get());
+		OutCellWidths.Add(Cell.Width);
+	}
+	OutRowHeight = Row.RowHeight;
+	return true;
+}
+
+void FEasyDataTableCellCache::PruneFiles()
+{
+	// Commandlets may not scan the assets at all, every table would look deleted
+	if (IsRunningCommandlet())
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		// Every table must be known before the files of missing ones can be told apart
+		AssetRegistry.OnFilesLoaded().AddLambda([]()
+		{
+			PruneFiles();
+		});
+		return;
+	}
+
+	TArray<FAssetData> TableAssets;
+	AssetRegistry.GetAssetsByClass(UDataTable::StaticClass()->GetClassPathName(), TableAssets, /*bSearchSubClasses*/ true);
+
+	TSet<FString> TableFilenames;
+	TableFilenames.Reserve(TableAssets.Num());
+	for (const FAssetData& TableAsset : TableAssets)
+	{
+		TableFilenames.Add(FPaths::GetCleanFilename(GetCacheFilename(TableAsset.PackageName.ToString())));
+	}
+
+	Async(EAsyncExecution::ThreadPool, [CacheDirectory = GetCacheDirectory(), TableFilenames = MoveTemp(TableFilenames)]()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FEasyDataTableCellCache::PruneFiles);
+
+		IFileManager& FileManager = IFileManager::Get();
+
+		TArray<FString> Filenames;
+		FileManager.FindFiles(Filenames, *(CacheDirectory / TEXT("*.bin")), true, false);
+		for (const FString& Filename : Filenames)
+		{
+			const FString Path = CacheDirectory / Filename;
+
+			FEasyDataTableCellCacheHeader Header;
+			FMemory::Memzero(Header);
+			if (TableFilenames.Contains(Filename))
+			{
+				const TUniquePtr<FArchive> Reader(FileManager.CreateFileReader(*Path));
+				if (Reader && Reader->TotalSize() >= (int64)sizeof(Header))
+				{
+					Reader->Serialize(&Header, sizeof(Header));
+				}
+			}
+
+			// Files of deleted or renamed tables, and files written by another version, are never loaded again
+			if (Header.Magic != EasyDataTableCellCache::Magic || Header.Version != EasyDataTableCellCache::Version)
+			{
+				FileManager.Delete(*Path, false, false, true);
+			}
+		}
+
+		TArray<FString> TempFilenames;
+		FileManager.FindFiles(TempFilenames, *(CacheDirectory / TEXT("*.tmp")), true, false);
+		for (const FString& Filename : TempFilenames)
+		{
+			const FString Path = CacheDirectory / Filename;
+			if (FileManager.GetFileAgeSeconds(*Path) > EasyDataTableCellCache::MaxTempFileAgeSeconds)
+			{
+				FileManager.Delete(*Path, false, false, true);
+			}
+		}
+	});
+}
+
+FString FEasyDataTableCellCache::GetCacheDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("AssetData") / TEXT("DataTableEditorCellCache");
+}
+
+FString FEasyDataTableCellCache::GetCacheFilename(const FString& CacheName)
+{
+	FString SafeName = CacheName;
+	SafeName.RemoveFromStart(TEXT("/"));
+	SafeName.ReplaceCharInline(TEXT('/'), TEXT('_'));
+	return GetCacheDirectory() / SafeName + TEXT(".bin");
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyDataTableEditorUtils.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FEasyDataTableCellCacheCell;
+struct FEasyDataTableCellCacheHeader;
+struct FEasyDataTableCellCacheRow;
+
+/**
+ * Persistent cache of the cell text and measured sizes of a table, stored in Saved/ so that reopening an
+ * unchanged table does not have to export and measure every cell again.
+ *
+ * The file is keyed by package path and stamped with a hash of the row struct layout, the cell measurer and the
+ * culture; each row is stamped with a hash of its serialized data. Rows whose hash differs are recomputed by
+ * the caller. The format is flat (header, row records, cell records, UTF-8 string blob) and is read straight
+ * from a memory-mapped view.
+ */
+class EASYDATATABLEEDITOR_API FEasyDataTableCellCache
+{
+public:
+	~FEasyDataTableCellCache();
+
+	/**
+	 * Hash of everything that affects cell text and size other than the row data
+	 *
+	 * @param	MeasurerHash	IEasyDataTableCellMeasurer::GetLayoutHash of the measurer the sizes come from
+	 */
+	static uint64 HashLayout(const UScriptStruct* RowStruct, TConstArrayView<const FProperty*> Columns, uint64 MeasurerHash);
+
+	/** Hash of the serialized row data */
+	static uint64 HashRow(const UScriptStruct* RowStruct, const uint8* RowData);
+
+	/** Maps the cache file of a table, returns null if there is none or it was built for a different layout */
+	static TUniquePtr<FEasyDataTableCellCache> Load(const FString& CacheName, uint64 LayoutHash, int32 NumColumns);
+
+	/**
+	 * Writes the cache file of a table. The file content is built on the calling thread and written in the background.
+	 *
+	 * @param	CellWidths	Measured width of each cell, row-major
+	 */
+	static void Save(const FString& CacheName, uint64 LayoutHash, TConstArrayView<FEasyDataTableEditorColumnHeaderDataPtr> Columns, TConstArrayView<FEasyDataTableEditorRowListViewDataPtr> Rows, TConstArrayView<uint64> RowHashes, TConstArrayView<float> CellWidths);
+
+	/**
+	 * Reads the cached cells of a row
+	 *
+	 * @return	False if the row is not cached or its hash differs
+	 */
+	bool ReadRow(FName RowName, uint64 RowHash, TArray<FString>& OutCells, TArray<float>& OutCellWidths, float& OutRowHeight) const;
+
+	/**
+	 * Deletes the cache files of tables that no longer exist, those written by another version and temporary files
+	 * left by an interrupted write. Called at module startup; waits for the asset registry, then runs in the background.
+	 */
+	static void PruneFiles();
+
+private:
+	FEasyDataTableCellCache() = default;
+
+	static FString GetCacheDirectory();
+	static FString GetCacheFilename(const FString& CacheName);
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	const FEasyDataTableCellCacheHeader* Header = nullptr;
+	const FEasyDataTableCellCacheRow* Rows = nullptr;
+	const FEasyDataTableCellCacheCell* Cells = nullptr;
+	const UTF8CHAR* Strings = nullptr;
+
+	TMap<FName, int32> RowIndexByName;
+};
@@ -0,0 +1,148 @@
+#include "EasyDataTableCellFormatter.h"
+
+#include "DataTableUtils.h"
+#include "EasyDataTableEditorUtils.h"
+#include "UObject/SoftObjectPtr.h"
+#include "UObject/UnrealType.h"
+
+namespace EasyDataTableCellFormatter
+{
+	static const FName GameplayTagStructName(TEXT("GameplayTag"));
+	static const FName TagNamePropertyName(TEXT("TagName"));
+
+	static bool IsSoftObjectPathStruct(const UScriptStruct* Struct)
+	{
+		return Struct == TBaseStructure<FSoftObjectPath>::Get() || Struct == TBaseStructure<FSoftClassPath>::Get();
+	}
+
+	static uint64 GetNameKey(FName Name)
+	{
+		// The display index keeps names that only differ by case apart
+		return (uint64(Name.GetDisplayIndex().ToUnstableInt()) << 32) | uint64(uint32(Name.GetNumber()));
+	}
+}
+
+FEasyDataTableCellFormatter::FEasyDataTableCellFormatter(const FProperty* InProperty)
+	: Property(InProperty)
+{
+	using namespace EasyDataTableCellFormatter;
+
+	if (!Property || Property->ArrayDim != 1)
+	{
+		return;
+	}
+
+	if (Property->IsA<FNumericProperty>() || Property->IsA<FBoolProperty>() || Property->IsA<FEnumProperty>())
+	{
+		Kind = Property->GetElementSize() <= sizeof(uint64) ? EKind::RawValue : EKind::Generic;
+	}
+	else if (Property->IsA<FNameProperty>())
+	{
+		Kind = EKind::Name;
+	}
+	else if (Property->IsA<FStrProperty>())
+	{
+		Kind = EKind::String;
+	}
+	else if (Property->IsA<FSoftObjectProperty>())
+	{
+		Kind = EKind::SoftObjectPath;
+	}
+	else if (const FStructProperty* StructProp = CastField<const FStructProperty>(Property))
+	{
+		if (IsSoftObjectPathStruct(StructProp->Struct))
+		{
+			Kind = EKind::SoftObjectPath;
+		}
+		else if (StructProp->Struct->GetFName() == GameplayTagStructName)
+		{
+			TagNameProperty = CastField<const FNameProperty>(StructProp->Struct->FindPropertyByName(TagNamePropertyName));
+			Kind = TagNameProperty ? EKind::Name : EKind::Generic;
+		}
+	}
+}
+
+uint32 FEasyDataTableCellFormatter::AddCell(FEasyDataTableEditorColumnHeaderData& Column, const uint8* RowData, bool& bOutIsNew)
+{
+	using namespace EasyDataTableCellFormatter;
+
+	const uint8* ValuePtr = Property->ContainerPtrToValuePtr<uint8>(RowData, 0);
+	uint32* CachedCellId = nullptr;
+	switch (Kind)
+	{
+	case EKind::RawValue:
+		{
+			// Bool properties may share a byte with other bitfields, only the masked bit belongs to this column
+			uint64 RawValue = 0;
+			if (const FBoolProperty* BoolProp = CastField<const FBoolProperty>(Property))
+			{
+				RawValue = BoolProp->GetPropertyValue(ValuePtr) ? 1 : 0;
+			}
+			else
+			{
+				FMemory::Memcpy(&RawValue, ValuePtr, Property->GetElementSize());
+			}
+			CachedCellId = &CellIdsByRawValue.FindOrAdd(RawValue, MAX_uint32);
+		}
+		break;
+	case EKind::Name:
+		{
+			const FName Name = TagNameProperty
+				? TagNameProperty->GetPropertyValue_InContainer(ValuePtr)
+				: CastFieldChecked<const FNameProperty>(Property)->GetPropertyValue(ValuePtr);
+			CachedCellId = &CellIdsByRawValue.FindOrAdd(GetNameKey(Name), MAX_uint32);
+		}
+		break;
+	case EKind::String:
+		CachedCellId = &CellIdsByStringValue.FindOrAdd(CastFieldChecked<const FStrProperty>(Property)->GetPropertyValue(ValuePtr), MAX_uint32);
+		break;
+	case EKind::SoftObjectPath:
+		{
+			const FSoftObjectPath& Path = Property->IsA<FSoftObjectProperty>()
+				? CastFieldChecked<const FSoftObjectProperty>(Property)->GetPropertyValue(ValuePtr).ToSoftObjectPath()
+				: *reinterpret_cast<const FSoftObjectPath*>(ValuePtr);
+			CachedCellId = &CellIdsBySoftObjectPath.FindOrAdd(Path, MAX_uint32);
+		}
+		break;
+	default:
+		break;
+	}
+
+	uint32 CellId;
+	if (CachedCellId && *CachedCellId != MAX_uint32)
+	{
+		CellId = *CachedCellId;
+		bOutIsNew = false;
+	}
+	else
+	{
+		// Two values can format the same way (e.g. -0.0 and 0.0), so the string is still interned
+		CellId = InternString(Column, DataTableUtils::GetPropertyValueAsText(Property, RowData).ToString(), bOutIsNew);
+		if (CachedCellId)
+		{
+			*CachedCellId = CellId;
+		}
+	}
+
+	Column.RowCellIds.Add(CellId);
+	return CellId;
+}
+
+uint32 FEasyDataTableCellFormatter::AddCellString(FEasyDataTableEditorColumnHeaderData& Column, const FString& CellString, bool& bOutIsNew)
+{
+	const uint32 CellId = InternString(Column, CellString, bOutIsNew);
+	Column.RowCellIds.Add(CellId);
+	return CellId;
+}
+
+uint32 FEasyDataTableCellFormatter::InternString(FEasyDataTableEditorColumnHeaderData& Column, const FString& CellString, bool& bOutIsNew)
+{
+	const uint32 NextCellId = Column.CellStrings.Num();
+	const uint32 CellId = CellIdsByString.FindOrAdd(CellString, NextCellId);
+	bOutIsNew = CellId == NextCellId;
+	if (bOutIsNew)
+	{
+		Column.CellStrings.Add(CellString);
+	}
+	return CellId;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+struct FEasyDataTableEditorColumnHeaderData;
+
+/** Key funcs of a string map that compares and hashes case-sensitively, FString keys otherwise fold "Sword" and "sword" together */
+template <typename ValueType>
+struct TEasyDataTableCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+{
+	using KeyInitType = typename TDefaultMapKeyFuncs<FString, ValueType, false>::KeyInitType;
+
+	static FORCEINLINE bool Matches(KeyInitType A, KeyInitType B)
+	{
+		return A.Equals(B, ESearchCase::CaseSensitive);
+	}
+
+	static FORCEINLINE uint32 GetKeyHash(KeyInitType Key)
+	{
+		return FCrc::StrCrc32(*Key);
+	}
+};
+
+/**
+ * Turns the values of one column into the column's interned cell strings.
+ *
+ * The kind of the column property is resolved once. Numbers, bools, enums, names and gameplay tags are keyed by
+ * their value, strings and soft object references by their path, so each distinct value is formatted through
+ * DataTableUtils once and every repeat costs a single hash lookup. Other properties always take the generic path.
+ */
+class EASYDATATABLEEDITOR_API FEasyDataTableCellFormatter
+{
+public:
+	explicit FEasyDataTableCellFormatter(const FProperty* InProperty);
+
+	/**
+	 * Appends the cell of a row to the column
+	 *
+	 * @param	bOutIsNew	Set if the cell string was not in the column yet
+	 * @return	The cell ID
+	 */
+	uint32 AddCell(FEasyDataTableEditorColumnHeaderData& Column, const uint8* RowData, bool& bOutIsNew);
+
+	/** Appends a cell whose string is already known, e.g. read from the persistent cache */
+	uint32 AddCellString(FEasyDataTableEditorColumnHeaderData& Column, const FString& CellString, bool& bOutIsNew);
+
+private:
+	enum class EKind : uint8
+	{
+		/** Formatted every time */
+		Generic,
+		/** Keyed by the raw bytes of the value (numbers, bools, enums) */
+		RawValue,
+		/** Keyed by an FName, either the property itself or the tag name of a gameplay tag */
+		Name,
+		String,
+		SoftObjectPath,
+	};
+
+	uint32 InternString(FEasyDataTableEditorColumnHeaderData& Column, const FString& CellString, bool& bOutIsNew);
+
+	const FProperty* Property;
+	EKind Kind = EKind::Generic;
+
+	/** Property holding the FName of a gameplay tag */
+	const FNameProperty* TagNameProperty = nullptr;
+
+	/** The string maps are case-sensitive, values that only differ in case are distinct cells */
+	TMap<FString, uint32, FDefaultSetAllocator, TEasyDataTableCaseSensitiveKeyFuncs<uint32>> CellIdsByString;
+	TMap<uint64, uint32> CellIdsByRawValue;
+	TMap<FString, uint32, FDefaultSetAllocator, TEasyDataTableCaseSensitiveKeyFuncs<uint32>> CellIdsByStringValue;
+	TMap<FSoftObjectPath, uint32> CellIdsBySoftObjectPath;
+};
@@ -0,0 +1,56 @@
+#include "EasyDataTableCellMeasurer.h"
+
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Hash/xxhash.h"
+#include "Rendering/SlateRenderer.h"
+#include "Styling/AppStyle.h"
+#include "Styling/SlateTypes.h"
+
+namespace EasyDataTableCellMeasurer
+{
+	static const FSlateFontInfo& GetCellFont()
+	{
+		return FAppStyle::GetWidgetStyle<FTextBlockStyle>("DataTableEditor.CellText").Font;
+	}
+
+	static TSharedRef<FSlateFontMeasure> GetFontMeasure()
+	{
+		return FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	}
+}
+
+TSharedPtr<const IEasyDataTableCellMeasurer> FEasyDataTableSlateCellMeasurer::Get()
+{
+	if (!FSlateApplication::IsInitialized() || !FSlateApplication::Get().GetRenderer())
+	{
+		return nullptr;
+	}
+
+	// Stateless, so every grid shares one and the model only rebuilds when a table goes from headless to shown
+	static const TSharedRef<const IEasyDataTableCellMeasurer> Measurer = MakeShared<FEasyDataTableSlateCellMeasurer>();
+	return Measurer;
+}
+
+FVector2D FEasyDataTableSlateCellMeasurer::Measure(const FString& Text) const
+{
+	return EasyDataTableCellMeasurer::GetFontMeasure()->Measure(Text, EasyDataTableCellMeasurer::GetCellFont());
+}
+
+float FEasyDataTableSlateCellMeasurer::GetMinRowHeight() const
+{
+	return EasyDataTableCellMeasurer::GetFontMeasure()->GetMaxCharacterHeight(EasyDataTableCellMeasurer::GetCellFont());
+}
+
+uint64 FEasyDataTableSlateCellMeasurer::GetLayoutHash() const
+{
+	const FSlateFontInfo& Font = EasyDataTableCellMeasurer::GetCellFont();
+	const FString TypefaceName = Font.TypefaceFontName.ToString();
+	const FString FontObjectPath = Font.FontObject ? Font.FontObject->GetPathName() : FString();
+
+	FXxHash64Builder Builder;
+	Builder.Update(&Font.Size, sizeof(Font.Size));
+	Builder.Update(*TypefaceName, TypefaceName.Len() * sizeof(TCHAR));
+	Builder.Update(*FontObjectPath, FontObjectPath.Len() * sizeof(TCHAR));
+	return Builder.Finalize().Hash;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Presentation side of the cell cache: the size a cell takes in the grid. The cached columns, rows, cell text and
+ * indices do not depend on it, so a table can be cached without a renderer by giving no measurer; the desired
+ * column widths and row heights then stay 0.
+ */
+class EASYDATATABLEEDITOR_API IEasyDataTableCellMeasurer
+{
+public:
+	virtual ~IEasyDataTableCellMeasurer() = default;
+
+	/** Size of a cell or column header showing the text, without padding */
+	virtual FVector2D Measure(const FString& Text) const = 0;
+
+	/** Height of a row whose cells are all empty */
+	virtual float GetMinRowHeight() const = 0;
+
+	/** Hash of everything the measured sizes depend on, stamped into the persistent cell cache */
+	virtual uint64 GetLayoutHash() const = 0;
+};
+
+/** Measures cells with the Slate font cache in the grid's cell text style. Requires a renderer and the game thread */
+class EASYDATATABLEEDITOR_API FEasyDataTableSlateCellMeasurer : public IEasyDataTableCellMeasurer
+{
+public:
+	/** The measurer of the grid, or null if Slate has no renderer, e.g. in a commandlet or with -nullrhi */
+	static TSharedPtr<const IEasyDataTableCellMeasurer> Get();
+
+	virtual FVector2D Measure(const FString& Text) const override;
+	virtual float GetMinRowHeight() const override;
+	virtual uint64 GetLayoutHash() const override;
+};
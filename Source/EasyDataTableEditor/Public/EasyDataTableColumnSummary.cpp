@@ -0,0 +1,103 @@
+#include "EasyDataTableColumnSummary.h"
+
+#include "EasyDataTableEditorUtils.h"
+#include "UObject/UnrealType.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableColumnSummary"
+
+bool FEasyDataTableColumnSummary::HasSummary(const FProperty* Property)
+{
+	if (FEasyDataTableNumericColumn::IsNumericProperty(Property))
+	{
+		return true;
+	}
+
+	if (!Property || Property->ArrayDim != 1)
+	{
+		return false;
+	}
+
+	const FByteProperty* ByteProp = CastField<const FByteProperty>(Property);
+	return Property->IsA<FEnumProperty>() || (ByteProp && ByteProp->Enum) || Property->IsA<FNameProperty>();
+}
+
+FEasyDataTableColumnSummary FEasyDataTableColumnSummary::ComputeNumeric(TArray<double> Values)
+{
+	FEasyDataTableColumnSummary Summary;
+	Summary.bIsNumeric = true;
+
+	FEasyDataTableNumericColumn Column;
+	Column.Values = MoveTemp(Values);
+	Summary.NumericStats = Column.ComputeStats();
+	Summary.NumValues = Column.Values.Num();
+
+	Column.Values.Sort();
+	for (int32 Index = 0; Index < Column.Values.Num(); ++Index)
+	{
+		if (Index == 0 || Column.Values[Index] != Column.Values[Index - 1])
+		{
+			++Summary.NumDistinctValues;
+		}
+	}
+
+	return Summary;
+}
+
+FEasyDataTableColumnSummary FEasyDataTableColumnSummary::ComputeFrequencies(TConstArrayView<uint32> RowCellIds, int32 NumCellIds)
+{
+	FEasyDataTableColumnSummary Summary;
+
+	TArray<int32> Counts;
+	Counts.SetNumZeroed(NumCellIds);
+	for (const uint32 CellId : RowCellIds)
+	{
+		++Counts[CellId];
+	}
+
+	for (int32 CellId = 0; CellId < NumCellIds; ++CellId)
+	{
+		if (Counts[CellId] > 0)
+		{
+			++Summary.NumDistinctValues;
+			Summary.TopValues.Emplace(CellId, Counts[CellId]);
+		}
+	}
+
+	Summary.TopValues.Sort([](const TPair<uint32, int32>& A, const TPair<uint32, int32>& B)
+	{
+		return A.Value != B.Value ? A.Value > B.Value : A.Key < B.Key;
+	});
+	Summary.TopValues.SetNum(FMath::Min(Summary.TopValues.Num(), NumTopValues));
+
+	Summary.NumValues = RowCellIds.Num();
+	return Summary;
+}
+
+FText FEasyDataTableColumnSummary::ToText(const FEasyDataTableEditorColumnHeaderData& Column) const
+{
+	if (bIsNumeric)
+	{
+		FFormatNamedArguments Args;
+		Args.Add(TEXT("Min"), FText::AsNumber(NumericStats.Min));
+		Args.Add(TEXT("Max"), FText::AsNumber(NumericStats.Max));
+		Args.Add(TEXT("Mean"), FText::AsNumber(NumericStats.Mean));
+		Args.Add(TEXT("StdDev"), FText::AsNumber(NumericStats.StdDev));
+		Args.Add(TEXT("Distinct"), FText::AsNumber(NumDistinctValues));
+		return FText::Format(LOCTEXT("NumericSummaryFmt", "Min: {Min}    Max: {Max}\nMean: {Mean}    Std Dev: {StdDev}\nDistinct Values: {Distinct}"), Args);
+	}
+
+	TArray<FText> Lines;
+	Lines.Add(FText::Format(LOCTEXT("DistinctValuesFmt", "Distinct Values: {0}"), FText::AsNumber(NumDistinctValues)));
+	for (const TPair<uint32, int32>& TopValue : TopValues)
+	{
+		const FString& CellString = Column.CellStrings.IsValidIndex(TopValue.Key) ? Column.CellStrings[TopValue.Key] : FString();
+		const double Fraction = NumValues > 0 ? static_cast<double>(TopValue.Value) / NumValues : 0.0;
+		Lines.Add(FText::Format(LOCTEXT("TopValueFmt", "{0}: {1} ({2})"),
+			CellString.IsEmpty() ? LOCTEXT("EmptyValue", "(empty)") : FText::FromString(CellString),
+			FText::AsNumber(TopValue.Value),
+			FText::AsPercent(Fraction)));
+	}
+	return FText::Join(FText::FromString(TEXT("\n")), Lines);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyDataTableNumericColumn.h"
+
+struct FEasyDataTableEditorColumnHeaderData;
+
+/** Summary statistics of one column, shown in its header tooltip. Computed on a worker thread from copied inputs. */
+struct EASYDATATABLEEDITOR_API FEasyDataTableColumnSummary
+{
+	/** Number of values shown for enum and name columns */
+	static constexpr int32 NumTopValues = 5;
+
+	bool bIsNumeric = false;
+
+	/** Min, max, mean and standard deviation of a numeric column */
+	FEasyDataTableNumericStats NumericStats;
+
+	int32 NumValues = 0;
+	int32 NumDistinctValues = 0;
+
+	/** Most frequent cell IDs and their counts, most frequent first */
+	TArray<TPair<uint32, int32>> TopValues;
+
+	/** True if the property gets a numeric or a frequency summary */
+	static bool HasSummary(const FProperty* Property);
+
+	static FEasyDataTableColumnSummary ComputeNumeric(TArray<double> Values);
+	static FEasyDataTableColumnSummary ComputeFrequencies(TConstArrayView<uint32> RowCellIds, int32 NumCellIds);
+
+	/** Formats the summary, the column provides the strings of the cell IDs */
+	FText ToText(const FEasyDataTableEditorColumnHeaderData& Column) const;
+};
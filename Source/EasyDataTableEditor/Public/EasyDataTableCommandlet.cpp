@@ -0,0 +1,641 @@
+#include "EasyDataTableCommandlet.h"
+
+#include "DataTableUtils.h"
+#include "EasyDataTableEditorUtils.h"
+#include "EasyDataTableExporter.h"
+#include "EasyDataTableImporter.h"
+#include "Engine/CompositeDataTable.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "Math/BasicMathExpressionEvaluator.h"
+#include "Misc/DataValidation.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+namespace EasyDataTableCommandlet
+{
+	/** Column name that stands for the row name in queries and expressions */
+	static const TCHAR* RowNameColumn = TEXT("RowName");
+
+	/** Placeholder of the table name in file names */
+	static const TCHAR* TableToken = TEXT("{Table}");
+
+	struct FOptions
+	{
+		FString ImportFilename;
+		FEasyDataTableImporter::EImportMode ImportMode = FEasyDataTableImporter::EImportMode::Replace;
+		FString Renames;
+		FString Assignments;
+		FString Where;
+		FString Delete;
+		bool bValidate = false;
+		FString ExportFilename;
+		bool bSave = false;
+
+		bool WritesTable() const
+		{
+			return !ImportFilename.IsEmpty() || !Renames.IsEmpty() || !Assignments.IsEmpty() || !Delete.IsEmpty();
+		}
+	};
+
+	/**
+	 * Finds a column by property name or export name
+	 *
+	 * @param	OutProperty		Set to null for the row name
+	 * @return	False if the row struct has no such column
+	 */
+	static bool FindColumn(const UScriptStruct* RowStruct, const FString& ColumnName, const FProperty*& OutProperty)
+	{
+		OutProperty = nullptr;
+		if (ColumnName == RowNameColumn)
+		{
+			return true;
+		}
+
+		for (TFieldIterator<const FProperty> It(RowStruct); It; ++It)
+		{
+			if (It->GetName() == ColumnName || DataTableUtils::GetPropertyExportName(*It) == ColumnName)
+			{
+				OutProperty = *It;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Cell text in the format the importer reads and the exporter writes */
+	static FString GetCellString(const FProperty* Property, FName RowName, const uint8* RowData)
+	{
+		return Property ? DataTableUtils::GetPropertyValueAsString(Property, RowData, EDataTableExportFlags::None) : RowName.ToString();
+	}
+
+	/** One <Column> <Operator> <Value> term of a query */
+	struct FCondition
+	{
+		enum class EOperator
+		{
+			Equal,
+			NotEqual,
+			Less,
+			LessEqual,
+			Greater,
+			GreaterEqual,
+			Contains,
+		};
+
+		const FProperty* Property = nullptr;
+		EOperator Operator = EOperator::Equal;
+		FString Value;
+
+		bool Matches(FName RowName, const uint8* RowData) const
+		{
+			const FString CellString = GetCellString(Property, RowName, RowData);
+			if (Operator == EOperator::Contains)
+			{
+				return CellString.Contains(Value);
+			}
+
+			int32 Comparison = 0;
+			// IsNumeric accepts an empty string, which must not compare as 0
+			if (!CellString.IsEmpty() && !Value.IsEmpty() && FCString::IsNumeric(*CellString) && FCString::IsNumeric(*Value))
+			{
+				const double CellNumber = FCString::Atod(*CellString);
+				const double ValueNumber = FCString::Atod(*Value);
+				Comparison = CellNumber < ValueNumber ? -1 : (CellNumber > ValueNumber ? 1 : 0);
+			}
+			else
+			{
+				Comparison = CellString.Compare(Value, ESearchCase::IgnoreCase);
+			}
+
+			switch (Operator)
+			{
+			case EOperator::Equal:			return Comparison == 0;
+			case EOperator::NotEqual:		return Comparison != 0;
+			case EOperator::Less:			return Comparison < 0;
+			case EOperator::LessEqual:		return Comparison <= 0;
+			case EOperator::Greater:		return Comparison > 0;
+			case EOperator::GreaterEqual:	return Comparison >= 0;
+			default:						return false;
+			}
+		}
+	};
+
+	/** Conditions joined by &&, an empty query matches every row */
+	struct FQuery
+	{
+		TArray<FCondition> Conditions;
+
+		bool Parse(const UScriptStruct* RowStruct, const FString& Query, FString& OutError)
+		{
+			// Two character operators first, so that <= is not read as <
+			static const TPair<const TCHAR*, FCondition::EOperator> Operators[] =
+			{
+				{ TEXT("=="), FCondition::EOperator::Equal },
+				{ TEXT("!="), FCondition::EOperator::NotEqual },
+				{ TEXT("<="), FCondition::EOperator::LessEqual },
+				{ TEXT(">="), FCondition::EOperator::GreaterEqual },
+				{ TEXT("="), FCondition::EOperator::Equal },
+				{ TEXT("<"), FCondition::EOperator::Less },
+				{ TEXT(">"), FCondition::EOperator::Greater },
+				{ TEXT("~"), FCondition::EOperator::Contains },
+			};
+
+			TArray<FString> Terms;
+			Query.ParseIntoArray(Terms, TEXT("&&"));
+			for (const FString& Term : Terms)
+			{
+				int32 OperatorIndex = INDEX_NONE;
+				int32 OperatorLength = 0;
+				FCondition Condition;
+				for (int32 CharIndex = 0; CharIndex < Term.Len() && OperatorIndex == INDEX_NONE; ++CharIndex)
+				{
+					for (const TPair<const TCHAR*, FCondition::EOperator>& Operator : Operators)
+					{
+						const int32 Length = FCString::Strlen(Operator.Key);
+						if (FCString::Strncmp(*Term + CharIndex, Operator.Key, Length) == 0)
+						{
+							OperatorIndex = CharIndex;
+							OperatorLength = Length;
+							Condition.Operator = Operator.Value;
+							break;
+						}
+					}
+				}
+				if (OperatorIndex == INDEX_NONE)
+				{
+					OutError = FString::Printf(TEXT("'%s' has no operator"), *Term.TrimStartAndEnd());
+					return false;
+				}
+
+				const FString ColumnName = Term.Left(OperatorIndex).TrimStartAndEnd();
+				if (!FindColumn(RowStruct, ColumnName, Condition.Property))
+				{
+					OutError = FString::Printf(TEXT("Unknown column '%s'"), *ColumnName);
+					return false;
+				}
+				Condition.Value = Term.Mid(OperatorIndex + OperatorLength).TrimStartAndEnd().TrimQuotes();
+				Conditions.Add(MoveTemp(Condition));
+			}
+			return true;
+		}
+
+		bool Matches(FName RowName, const uint8* RowData) const
+		{
+			for (const FCondition& Condition : Conditions)
+			{
+				if (!Condition.Matches(RowName, RowData))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	/** The right hand side of an assignment, split once into literal text and {Column} references */
+	struct FExpression
+	{
+		/** One more literal than columns, the expanded text alternates them */
+		TArray<FString> Literals;
+		TArray<const FProperty*> Columns;
+
+		bool Parse(const UScriptStruct* RowStruct, const FString& Expression, FString& OutError)
+		{
+			int32 Start = 0;
+			int32 OpenIndex = INDEX_NONE;
+			while ((OpenIndex = Expression.Find(TEXT("{"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start)) != INDEX_NONE)
+			{
+				const int32 CloseIndex = Expression.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, OpenIndex);
+				if (CloseIndex == INDEX_NONE)
+				{
+					OutError = FString::Printf(TEXT("Missing } in '%s'"), *Expression);
+					return false;
+				}
+
+				const FString ColumnName = Expression.Mid(OpenIndex + 1, CloseIndex - OpenIndex - 1).TrimStartAndEnd();
+				const FProperty* Property = nullptr;
+				if (!FindColumn(RowStruct, ColumnName, Property))
+				{
+					OutError = FString::Printf(TEXT("Unknown column '%s'"), *ColumnName);
+					return false;
+				}
+
+				Literals.Add(Expression.Mid(Start, OpenIndex - Start));
+				Columns.Add(Property);
+				Start = CloseIndex + 1;
+			}
+			Literals.Add(Expression.Mid(Start));
+			return true;
+		}
+
+		FString Expand(FName RowName, const uint8* RowData) const
+		{
+			FString Result = Literals[0];
+			for (int32 Index = 0; Index < Columns.Num(); ++Index)
+			{
+				Result += GetCellString(Columns[Index], RowName, RowData);
+				Result += Literals[Index + 1];
+			}
+			return Result;
+		}
+	};
+
+	static bool IsMathColumn(const FProperty* Property)
+	{
+		const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+		return NumericProperty && !NumericProperty->IsEnum();
+	}
+
+	static FString ExpandFilename(const FString& Filename, const UDataTable* DataTable)
+	{
+		return Filename.Replace(TableToken, *DataTable->GetName(), ESearchCase::IgnoreCase);
+	}
+
+	static UDataTable* LoadTable(const FString& TablePath)
+	{
+		// Accept package names as well as object paths
+		FString ObjectPath = TablePath.TrimStartAndEnd();
+		if (!ObjectPath.Contains(TEXT(".")))
+		{
+			ObjectPath = ObjectPath + TEXT(".") + FPackageName::GetShortName(ObjectPath);
+		}
+		return LoadObject<UDataTable>(nullptr, *ObjectPath);
+	}
+
+	static bool ImportTable(UDataTable* DataTable, const FOptions& Options)
+	{
+		const FString Filename = ExpandFilename(Options.ImportFilename, DataTable);
+		TArray<FString> Problems;
+		const bool bSuccess = FEasyDataTableImporter::ImportFile(DataTable, Filename, Options.ImportMode, Problems);
+		for (const FString& Problem : Problems)
+		{
+			UE_LOG(LogDataTable, Warning, TEXT("%s: %s"), *Filename, *Problem);
+		}
+		UE_LOG(LogDataTable, Display, TEXT("%s: %s %s"), *DataTable->GetPathName(), bSuccess ? TEXT("imported") : TEXT("failed to import"), *Filename);
+		return bSuccess;
+	}
+
+	static bool RenameRows(UDataTable* DataTable, const FOptions& Options)
+	{
+		TArray<FString> Pairs;
+		Options.Renames.ParseIntoArray(Pairs, TEXT(","));
+
+		TArray<TPair<FName, FName>> Renames;
+		for (const FString& Pair : Pairs)
+		{
+			FString OldName;
+			FString NewName;
+			if (!Pair.Split(TEXT("="), &OldName, &NewName))
+			{
+				UE_LOG(LogDataTable, Error, TEXT("Rename '%s' is not <Old>=<New>"), *Pair);
+				return false;
+			}
+			Renames.Emplace(FName(*OldName.TrimStartAndEnd()), DataTableUtils::MakeValidName(NewName.TrimStartAndEnd()));
+		}
+
+		const int32 NumRenamed = FEasyDataTableEditorUtils::RenameRows(DataTable, Renames);
+		UE_LOG(LogDataTable, Display, TEXT("%s: renamed %d of %d rows"), *DataTable->GetPathName(), NumRenamed, Renames.Num());
+		if (NumRenamed != Renames.Num())
+		{
+			UE_LOG(LogDataTable, Warning, TEXT("%s: a row to rename was not found or its new name is in use"), *DataTable->GetPathName());
+		}
+		return true;
+	}
+
+	static bool SetColumns(UDataTable* DataTable, const FOptions& Options)
+	{
+		FQuery Where;
+		FString Error;
+		if (!Where.Parse(DataTable->RowStruct, Options.Where, Error))
+		{
+			UE_LOG(LogDataTable, Error, TEXT("Invalid -Where: %s"), *Error);
+			return false;
+		}
+
+		TArray<FString> AssignmentStrings;
+		Options.Assignments.ParseIntoArray(AssignmentStrings, TEXT(";"));
+
+		TArray<const FProperty*> Properties;
+		TArray<FExpression> Expressions;
+		for (const FString& Assignment : AssignmentStrings)
+		{
+			FString ColumnName;
+			FString ExpressionString;
+			const FProperty* Property = nullptr;
+			if (!Assignment.Split(TEXT("="), &ColumnName, &ExpressionString))
+			{
+				UE_LOG(LogDataTable, Error, TEXT("Assignment '%s' is not <Column>=<Expression>"), *Assignment);
+				return false;
+			}
+			if (!FindColumn(DataTable->RowStruct, ColumnName.TrimStartAndEnd(), Property) || !Property)
+			{
+				UE_LOG(LogDataTable, Error, TEXT("Unknown column '%s'"), *ColumnName.TrimStartAndEnd());
+				return false;
+			}
+
+			FExpression& Expression = Expressions.AddDefaulted_GetRef();
+			if (!Expression.Parse(DataTable->RowStruct, ExpressionString.TrimStartAndEnd(), Error))
+			{
+				UE_LOG(LogDataTable, Error, TEXT("Invalid expression for '%s': %s"), *Property->GetName(), *Error);
+				return false;
+			}
+			Properties.Add(Property);
+		}
+
+		// Every value is computed before any is written, so assignments read the values from before the set
+		TArray<FString> Problems;
+		TArray<TArray<TPair<FName, FString>>> ValuesByAssignment;
+		ValuesByAssignment.SetNum(Properties.Num());
+		FBasicMathExpressionEvaluator Evaluator;
+		for (const TPair<FName, uint8*>& Row : DataTable->GetRowMap())
+		{
+			if (!Where.Matches(Row.Key, Row.Value))
+			{
+				continue;
+			}
+
+			for (int32 Index = 0; Index < Properties.Num(); ++Index)
+			{
+				FString Value = Expressions[Index].Expand(Row.Key, Row.Value);
+				if (IsMathColumn(Properties[Index]))
+				{
+					TValueOrError<double, FExpressionError> Result = Evaluator.Evaluate(*Value);
+					if (Result.HasError())
+					{
+						Problems.Add(FString::Printf(TEXT("Row '%s', column '%s': cannot evaluate '%s': %s"), *Row.Key.ToString(), *Properties[Index]->GetName(), *Value, *Result.GetError().Text.ToString()));
+						continue;
+					}
+
+					const double Number = Result.GetValue();
+					Value = CastField<FNumericProperty>(Properties[Index])->IsInteger() ? LexToString(FMath::RoundToInt64(Number)) : FString::SanitizeFloat(Number);
+				}
+				ValuesByAssignment[Index].Emplace(Row.Key, MoveTemp(Value));
+			}
+		}
+
+		for (int32 Index = 0; Index < Properties.Num(); ++Index)
+		{
+			const int32 NumChanged = FEasyDataTableEditorUtils::SetColumnValues(DataTable, Properties[Index]->GetFName(), ValuesByAssignment[Index], Problems);
+			UE_LOG(LogDataTable, Display, TEXT("%s: set %d of %d cells of column '%s'"), *DataTable->GetPathName(), NumChanged, ValuesByAssignment[Index].Num(), *Properties[Index]->GetName());
+		}
+
+		for (const FString& Problem : Problems)
+		{
+			UE_LOG(LogDataTable, Error, TEXT("%s: %s"), *DataTable->GetPathName(), *Problem);
+		}
+		return Problems.IsEmpty();
+	}
+
+	static bool DeleteRows(UDataTable* DataTable, const FOptions& Options)
+	{
+		FQuery Query;
+		FString Error;
+		if (!Query.Parse(DataTable->RowStruct, Options.Delete, Error) || Query.Conditions.IsEmpty())
+		{
+			UE_LOG(LogDataTable, Error, TEXT("Invalid -Delete: %s"), Error.IsEmpty() ? TEXT("the query is empty") : *Error);
+			return false;
+		}
+
+		TArray<FName> RowNames;
+		for (const TPair<FName, uint8*>& Row : DataTable->GetRowMap())
+		{
+			if (Query.Matches(Row.Key, Row.Value))
+			{
+				RowNames.Add(Row.Key);
+			}
+		}
+
+		const int32 NumRemoved = FEasyDataTableEditorUtils::RemoveRows(DataTable, RowNames);
+		UE_LOG(LogDataTable, Display, TEXT("%s: deleted %d rows"), *DataTable->GetPathName(), NumRemoved);
+		return true;
+	}
+
+	/** @return	False if the table has errors, warnings are only logged */
+	static bool ValidateTable(const UDataTable* DataTable)
+	{
+		const FString TablePath = DataTable->GetPathName();
+		const UScriptStruct* RowStruct = DataTable->RowStruct;
+		if (!RowStruct)
+		{
+			UE_LOG(LogDataTable, Error, TEXT("%s: the row struct is missing"), *TablePath);
+			return false;
+		}
+
+		int32 NumErrors = 0;
+		int32 NumWarnings = 0;
+
+		// Each value goes through the same text conversion as an export followed by an import
+		TArray<const FProperty*> Properties;
+		TArray<void*> ScratchValues;
+		for (TFieldIterator<const FProperty> It(RowStruct); It; ++It)
+		{
+			if (It->ArrayDim == 1)
+			{
+				void* ScratchValue = FMemory::Malloc(It->GetSize(), It->GetMinAlignment());
+				It->InitializeValue(ScratchValue);
+				Properties.Add(*It);
+				ScratchValues.Add(ScratchValue);
+			}
+		}
+
+		for (const TPair<FName, uint8*>& Row : DataTable->GetRowMap())
+		{
+			if (DataTableUtils::MakeValidName(Row.Key.ToString()) != Row.Key)
+			{
+				UE_LOG(LogDataTable, Warning, TEXT("%s: row name '%s' has characters that are not valid in a row name"), *TablePath, *Row.Key.ToString());
+				++NumWarnings;
+			}
+
+			for (int32 Index = 0; Index < Properties.Num(); ++Index)
+			{
+				const FProperty* Property = Properties[Index];
+				Property->ClearValue(ScratchValues[Index]);
+
+				const FString CellString = DataTableUtils::GetPropertyValueAsString(Property, Row.Value, EDataTableExportFlags::None);
+				const FString ImportError = DataTableUtils::AssignStringToPropertyDirect(CellString, Property, static_cast<uint8*>(ScratchValues[Index]));
+				if (!ImportError.IsEmpty() || !Property->Identical(Property->ContainerPtrToValuePtr<void>(Row.Value), ScratchValues[Index], PPF_None))
+				{
+					UE_LOG(LogDataTable, Warning, TEXT("%s: row '%s', column '%s' changes when exported and imported again"), *TablePath, *Row.Key.ToString(), *Property->GetName());
+					++NumWarnings;
+				}
+			}
+		}
+
+		for (int32 Index = 0; Index < Properties.Num(); ++Index)
+		{
+			Properties[Index]->DestroyValue(ScratchValues[Index]);
+			FMemory::Free(ScratchValues[Index]);
+		}
+
+		FDataValidationContext Context;
+		DataTable->IsDataValid(Context);
+		for (const FDataValidationContext::FIssue& Issue : Context.GetIssues())
+		{
+			const FString Message = Issue.TokenizedMessage.IsValid() ? Issue.TokenizedMessage->ToText().ToString() : Issue.Message.ToString();
+			if (Issue.Severity == EMessageSeverity::Error)
+			{
+				UE_LOG(LogDataTable, Error, TEXT("%s: %s"), *TablePath, *Message);
+				++NumErrors;
+			}
+			else
+			{
+				UE_LOG(LogDataTable, Warning, TEXT("%s: %s"), *TablePath, *Message);
+				++NumWarnings;
+			}
+		}
+
+		UE_LOG(LogDataTable, Display, TEXT("%s: validated %d rows, %d errors, %d warnings"), *TablePath, DataTable->GetRowMap().Num(), NumErrors, NumWarnings);
+		return NumErrors == 0;
+	}
+
+	static bool ExportTable(const UDataTable* DataTable, const FOptions& Options)
+	{
+		const FString Filename = ExpandFilename(Options.ExportFilename, DataTable);
+		FString Error;
+		if (!FEasyDataTableExporter::ExportTable(DataTable, Filename, Error))
+		{
+			UE_LOG(LogDataTable, Error, TEXT("%s: failed to export to %s: %s"), *DataTable->GetPathName(), *Filename, *Error);
+			return false;
+		}
+		UE_LOG(LogDataTable, Display, TEXT("%s: exported to %s"), *DataTable->GetPathName(), *Filename);
+		return true;
+	}
+
+	static bool SaveTable(UDataTable* DataTable)
+	{
+		UPackage* Package = DataTable->GetOutermost();
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (IFileManager::Get().IsReadOnly(*Filename))
+		{
+			UE_LOG(LogDataTable, Error, TEXT("%s: %s is read only, check it out first"), *DataTable->GetPathName(), *Filename);
+			return false;
+		}
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.Error = GWarn;
+		if (!UPackage::SavePackage(Package, DataTable, *Filename, SaveArgs))
+		{
+			UE_LOG(LogDataTable, Error, TEXT("%s: failed to save %s"), *DataTable->GetPathName(), *Filename);
+			return false;
+		}
+		UE_LOG(LogDataTable, Display, TEXT("%s: saved"), *DataTable->GetPathName());
+		return true;
+	}
+
+	/** Applies the operations to a table, stopping at the first that fails */
+	static bool ProcessTable(UDataTable* DataTable, const FOptions& Options)
+	{
+		if (Options.WritesTable() && DataTable->IsA<UCompositeDataTable>())
+		{
+			UE_LOG(LogDataTable, Error, TEXT("%s: composite data tables take their rows from their parents and cannot be edited"), *DataTable->GetPathName());
+			return false;
+		}
+		if (!Options.Renames.IsEmpty() || !Options.Assignments.IsEmpty() || !Options.Delete.IsEmpty())
+		{
+			if (!DataTable->RowStruct)
+			{
+				UE_LOG(LogDataTable, Error, TEXT("%s: the row struct is missing"), *DataTable->GetPathName());
+				return false;
+			}
+		}
+
+		bool bSuccess = true;
+		bSuccess = bSuccess && (Options.ImportFilename.IsEmpty() || ImportTable(DataTable, Options));
+		bSuccess = bSuccess && (Options.Renames.IsEmpty() || RenameRows(DataTable, Options));
+		bSuccess = bSuccess && (Options.Assignments.IsEmpty() || SetColumns(DataTable, Options));
+		bSuccess = bSuccess && (Options.Delete.IsEmpty() || DeleteRows(DataTable, Options));
+		bSuccess = bSuccess && (!Options.bValidate || ValidateTable(DataTable));
+		bSuccess = bSuccess && (Options.ExportFilename.IsEmpty() || ExportTable(DataTable, Options));
+
+		if (Options.bSave && DataTable->GetOutermost()->IsDirty())
+		{
+			if (bSuccess)
+			{
+				bSuccess = SaveTable(DataTable);
+			}
+			else
+			{
+				UE_LOG(LogDataTable, Warning, TEXT("%s: not saved because an operation failed"), *DataTable->GetPathName());
+			}
+		}
+		return bSuccess;
+	}
+}
+
+UEasyDataTableCommandlet::UEasyDataTableCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Imports, edits, validates and exports data tables without the editor UI");
+	HelpUsage = TEXT("-run=EasyDataTable -Table=<Path>[,<Path>] [-Import=<File> [-ImportMode=Replace|Merge]] [-Rename=\"<Old>=<New>,...\"] [-Set=\"<Column>=<Expression>;...\" [-Where=\"<Query>\"]] [-Delete=\"<Query>\"] [-Validate] [-Export=<File>] [-Save]");
+}
+
+int32 UEasyDataTableCommandlet::Main(const FString& Params)
+{
+	using namespace EasyDataTableCommandlet;
+
+	FString TableList;
+	if (!FParse::Value(*Params, TEXT("-Table="), TableList, false))
+	{
+		UE_LOG(LogDataTable, Error, TEXT("No table given. Usage: %s"), *HelpUsage);
+		return 1;
+	}
+
+	FOptions Options;
+	FParse::Value(*Params, TEXT("-Import="), Options.ImportFilename, false);
+	FParse::Value(*Params, TEXT("-Rename="), Options.Renames, false);
+	FParse::Value(*Params, TEXT("-Set="), Options.Assignments, false);
+	FParse::Value(*Params, TEXT("-Where="), Options.Where, false);
+	FParse::Value(*Params, TEXT("-Delete="), Options.Delete, false);
+	FParse::Value(*Params, TEXT("-Export="), Options.ExportFilename, false);
+	Options.bValidate = FParse::Param(*Params, TEXT("Validate"));
+	Options.bSave = FParse::Param(*Params, TEXT("Save"));
+
+	FString ImportMode;
+	if (FParse::Value(*Params, TEXT("-ImportMode="), ImportMode))
+	{
+		if (ImportMode == TEXT("Merge"))
+		{
+			Options.ImportMode = FEasyDataTableImporter::EImportMode::Merge;
+		}
+		else if (ImportMode != TEXT("Replace"))
+		{
+			UE_LOG(LogDataTable, Error, TEXT("Unknown import mode '%s', expected Replace or Merge"), *ImportMode);
+			return 1;
+		}
+	}
+	if (!Options.Where.IsEmpty() && Options.Assignments.IsEmpty())
+	{
+		UE_LOG(LogDataTable, Error, TEXT("-Where only applies to -Set"));
+		return 1;
+	}
+
+	TArray<FString> TablePaths;
+	TableList.ParseIntoArray(TablePaths, TEXT(","));
+
+	int32 NumFailedTables = 0;
+	for (const FString& TablePath : TablePaths)
+	{
+		UDataTable* DataTable = LoadTable(TablePath);
+		if (!DataTable)
+		{
+			UE_LOG(LogDataTable, Error, TEXT("Could not load data table '%s'"), *TablePath);
+			++NumFailedTables;
+			continue;
+		}
+
+		if (!ProcessTable(DataTable, Options))
+		{
+			++NumFailedTables;
+		}
+	}
+
+	UE_LOG(LogDataTable, Display, TEXT("Processed %d tables, %d failed"), TablePaths.Num(), NumFailedTables);
+	return NumFailedTables > 0 ? 1 : 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EasyDataTableCommandlet.generated.h"
+
+/**
+ * Batch operations on data tables without opening the editor UI, for build scripts and CI.
+ * Goes through FEasyDataTableEditorUtils, the importer and the exporter like the editor does, but never builds the
+ * cell cache of the grid, so it runs with -nullrhi.
+ *
+ * UnrealEditor-Cmd <Project> -run=EasyDataTable -Table=/Game/Data/DT_Items[,/Game/Data/DT_Other] [operations]
+ *
+ * Operations are applied to each table in this order, whatever their order on the command line:
+ *   -Import=<File> [-ImportMode=Replace|Merge]           Imports a .csv or .json file, Replace by default
+ *   -Rename="<Old>=<New>,..."                            Renames rows
+ *   -Set="<Column>=<Expression>;..." [-Where="<Query>"]  Writes columns of every row, or of the rows matching the query
+ *   -Delete="<Query>"                                    Removes the rows matching the query
+ *   -Validate                                            Reports bad row names, values that do not survive an export and data validation errors
+ *   -Export=<File>                                       Exports the table to a .csv or .json file
+ *   -Save                                                Saves the tables that changed, unless an operation on them failed
+ *
+ * {Table} in a file name is replaced by the table name. In an expression, {Column} is replaced by the cell text of the
+ * row, and {RowName} by its name; the result of an expression written to a numeric column is evaluated as math,
+ * e.g. -Set="Damage={Damage}*1.5". All assignments of a set read the values from before the set.
+ *
+ * A query is one or more conditions joined by &&, each <Column> <Operator> <Value> with the operators
+ * == (or =), !=, <, <=, >, >= and ~ (contains). RowName is the row name. Values compare as numbers when both sides
+ * are numbers, as case-insensitive text otherwise, e.g. -Delete="Level < 5 && RowName ~ Test".
+ *
+ * Returns 1 if a table could not be loaded, an operation failed or validation found errors.
+ */
+UCLASS()
+class UEasyDataTableCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEasyDataTableCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -4,10 +4,12 @@
 
 #include "Containers/Array.h"
 #include "Containers/BitArray.h"
+#include "Containers/Ticker.h"
 #include "Containers/Set.h"
 #include "Containers/SparseArray.h"
 #include "Containers/UnrealString.h"
 #include "EasyDataTableEditorUtils.h"
+#include "EasyDataTableImporter.h"
 #include "Delegates/Delegate.h"
 #include "EditorUndoClient.h"
 #include "IEasyDataTableEditor.h"
@@ -16,6 +18,7 @@
 #include "Input/Reply.h"
 #include "Internationalization/Text.h"
 #include "Kismet2/StructureEditorUtils.h"
+#include "Layout/Visibility.h"
 #include "Math/Color.h"
 #include "Misc/Optional.h"
 #include "Styling/SlateColor.h"
@@ -98,6 +101,7 @@ public:
 	/** Get the data table being edited */
 	const UDataTable* GetDataTable() const;
 
+	/** Rebuilds the cached rows of the table, in this and every other editor of it */
 	void HandlePostChange();
 
 	void SetHighlightedRow(FName Name);
@@ -106,13 +110,52 @@ public:
 
 	FSlateColor GetRowTextColor(FName RowName) const;
 
+	/** Names of the rows in the multi-row selection, in table order */
+	void GetSelectedRowNames(TArray<FName>& OutRowNames) const;
+
 protected:
 
 	void RefreshCachedDataTable(const FName InCachedSelection = NAME_None, const bool bUpdateEvenIfValid = false);
 
+	/** Called by the shared model after it rebuilt the cached rows */
+	void HandleModelChanged();
+
+	/** Pulls the rebuilt rows from the model, keeping the highlighted row */
+	void ApplyModelChange(bool bRowsReassigned);
+
+	/** Whether the grid is on screen: its tab is in front of its stack and the editor in front of its window */
+	bool IsDataTableTabForeground() const;
+
+	/** Applies a model change that arrived while the grid was hidden, run on the grid's next paint */
+	EActiveTimerReturnType HandleDataTableTabForegrounded(double InCurrentTime, float InDeltaTime);
+
+	/** Applies a deferred model change now, for commands that read the rows while the grid is hidden. Also restores released rows */
+	void FlushDeferredModelChange();
+
+	/** Releases the cached rows once the grid stayed hidden for EasyDataTableEditor.ReleaseHiddenTableAfterSeconds */
+	bool HandleMemoryPolicyTicker(float DeltaTime);
+
+	/**
+	 * Drops the rows, row widgets and the model's cache of a hidden grid. Layout, highlighted row, selection
+	 * and scroll position are kept by name and offset, and applied again by RestoreCachedData.
+	 */
+	void ReleaseCachedData();
+
+	/** Rebuilds what ReleaseCachedData dropped */
+	void RestoreCachedData();
+
+	/** Selects the rows released by ReleaseCachedData that are cached by now */
+	void RestoreReleasedSelection();
+
 	void UpdateVisibleRows(const FName InCachedSelection = NAME_None, const bool bUpdateEvenIfValid = false);
 
 	void RestoreCachedSelection(const FName InCachedSelection, const bool bUpdateEvenIfValid = false);
+
+	/** Rebuilds VisibleRowIndices after VisibleRows was filtered or sorted */
+	void RebuildVisibleRowIndices();
+
+	/** Index into VisibleRows of a row, INDEX_NONE if it is unknown or filtered out */
+	int32 FindVisibleRowIndex(FName RowId) const;
 	
 	void OnFilterTextChanged(const FText& InFilterText);
 	void OnFilterTextCommitted(const FText& NewText, ETextCommit::Type CommitInfo);
@@ -124,8 +167,22 @@ protected:
 	FText GetCellText(FEasyDataTableEditorRowListViewDataPtr InRowDataPointer, int32 ColumnIndex) const;
 	FText GetCellToolTipText(FEasyDataTableEditorRowListViewDataPtr InRowDataPointer, int32 ColumnIndex) const;
 
+	/** Whether the row struct is a user defined struct, whose rows can differ from its defaults */
+	bool HasStructDefaults() const;
+
+	/** Visibility of the modified-from-default marker of a row, read from the model's cached comparison */
+	EVisibility GetRowModifiedMarkerVisibility(FEasyDataTableEditorRowListViewDataPtr InRowDataPointer) const;
+
+	/** Type of the column, followed by its summary statistics when it has any */
+	FText GetColumnHeaderToolTipText(int32 ColumnIndex) const;
+
 	TSharedRef<SVerticalBox> CreateContentBox();
 
+	/** Tab content, each created on the first paint of its tab, see SEasyDataTableLazyContent */
+	TSharedRef<SWidget> CreateDataTableTabWidget();
+	TSharedRef<SWidget> CreateDataTableDetailsWidget();
+	TSharedRef<SWidget> CreateRowEditorTabWidget();
+
 	TSharedRef<SWidget> CreateRowEditorBox();
 	virtual TSharedRef<SEasyRowEditor> CreateRowEditor(UDataTable* Table);
 
@@ -154,8 +211,26 @@ protected:
 
 	void LoadLayoutData();
 
+	/** Copies the view state into the layout data and schedules a write of the layout store */
 	void SaveLayoutData();
 
+	/** Clears and re-adds the header columns, honoring the hidden columns and column order */
+	void RebuildColumnHeaders();
+
+	/** Indices into AvailableColumns of the displayed columns, in display order */
+	TArray<int32> GetDisplayedColumnIndices() const;
+
+	TSharedRef<SWidget> MakeColumnMenu(FName ColumnId);
+	void HideColumn(FName ColumnId);
+	void ShowAllColumns();
+	void MoveColumn(FName ColumnId, int32 Direction);
+	bool CanMoveColumn(FName ColumnId, int32 Direction) const;
+	void ResetColumnOrder();
+	void OnColumnLayoutChanged();
+
+	/** Re-sorts the visible rows with the current sort column and mode */
+	void ApplySort();
+
 	/** Make the widget for a row entry in the data table row list view */
 	TSharedRef<ITableRow> MakeRowWidget(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, const TSharedRef<STableViewBase>& OwnerTable);
 
@@ -164,6 +239,30 @@ protected:
 
 	void OnRowSelectionChanged(FEasyDataTableEditorRowListViewDataPtr InNewSelection, ESelectInfo::Type InSelectInfo);
 
+	/**
+	 * Applies a ctrl or shift click on a row to the selection mask and moves the highlight to a selected row.
+	 * Called by the row, as the single selection list view sends no event for a click on the highlighted row.
+	 *
+	 * @return	False if the click is a plain click, left to the list view
+	 */
+	bool ApplyModifierClick(FEasyDataTableEditorRowListViewDataPtr InRowData, bool bToggle, bool bExtend);
+
+	/** Starts editing a cell in the grid, once the list view has scrolled its row into view */
+	void BeginCellEdit(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, int32 ColumnIndex);
+
+	/**
+	 * Starts editing the next cell that can be edited inline, after a cell edit was committed
+	 *
+	 * @param	RowOffset		Number of visible rows to move by, keeping the column
+	 * @param	ColumnOffset	Number of displayed columns to move by, keeping the row
+	 */
+	void MoveCellEdit(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, int32 ColumnIndex, int32 RowOffset, int32 ColumnOffset);
+
+	void OnItemScrolledIntoView(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, const TSharedPtr<ITableRow>& InWidget);
+
+	/** Writes the value of a cell edited in the grid, see FEasyDataTableEditorUtils::SetCellValue */
+	bool SetCellValue(FEasyDataTableEditorRowListViewDataPtr InRowDataPtr, int32 ColumnIndex, const FString& Value);
+
 	void CopySelectedRow();
 	void PasteOnSelectedRow();
 	void DuplicateSelectedRow();
@@ -201,6 +300,55 @@ protected:
 	void ExtendToolbar(TSharedPtr<FExtender> Extender);
 	void FillToolbar(FToolBarBuilder& ToolbarBuilder);
 
+	TSharedRef<SWidget> MakeImportMenu();
+	void OnImportClicked(FEasyDataTableImporter::EImportMode ImportMode);
+	bool CanImport() const;
+
+	enum class EExportScope
+	{
+		Table,
+		VisibleRows,
+		SelectedRows,
+	};
+	TSharedRef<SWidget> MakeExportMenu();
+	void OnExportClicked(EExportScope Scope);
+	bool CanExport(EExportScope Scope) const;
+
+	void TogglePerformanceStats();
+	bool IsPerformanceStatsVisible() const;
+	EVisibility GetPerformanceStatsVisibility() const;
+	FText GetPerformanceStatsText() const;
+
+	/** Progress strip shown while the model is still caching the rows of a large table */
+	EVisibility GetCacheProgressVisibility() const;
+	TOptional<float> GetCacheProgressPercent() const;
+	FText GetCacheProgressText() const;
+
+	/** Selection commands, each applied to SelectedRowMask a word at a time */
+	TSharedRef<SWidget> MakeSelectionMenu();
+	void SelectAllVisibleRows();
+	void InvertRowSelection();
+	void ClearRowSelection();
+	void SelectRowsModifiedFromDefault();
+	bool HasSelectedRows() const;
+
+	/** Selects the rows between two indices of VisibleRows, inclusive */
+	void SelectVisibleRowRange(int32 FirstVisibleIndex, int32 LastVisibleIndex);
+
+	/** Whether a row is part of the multi-row selection */
+	bool IsRowSelected(FEasyDataTableEditorRowListViewDataPtr RowData) const;
+
+	/** Tells the row editor that SelectedRowMask changed */
+	void NotifySelectedRowsChanged();
+
+	void ToggleFacetPanel();
+	bool IsFacetPanelVisible() const;
+	EVisibility GetFacetPanelVisibility() const;
+	void OnFacetsChanged();
+
+	/** Approximate heap memory held by the cached rows, columns and cell text */
+	SIZE_T GetCachedDataAllocatedSize() const;
+
 private:
 	UDataTable* GetEditableDataTable() const;
 
@@ -221,9 +369,45 @@ protected:
 		float CurrentWidth;
 	};
 
-	/** UI for the "Data Table" tab */
+	/** Time spent in each stage of the last refresh, shown in the performance strip */
+	struct FRefreshStats
+	{
+		double CellTextSeconds = 0.0;
+		double MeasureSeconds = 0.0;
+		double FilterSeconds = 0.0;
+		double SortSeconds = 0.0;
+
+		/** Accumulated by MakeRowWidget since the last refresh */
+		double WidgetGenerationSeconds = 0.0;
+
+		/** Heap memory held by the cache, only computed while the strip is visible */
+		SIZE_T CacheBytes = 0;
+	};
+
+	/** UI for the "Data Table" tab, created on the tab's first paint */
 	TSharedPtr<SWidget> DataTableTabWidget;
 
+	/** The "Data Table" tab, to tell whether the grid is on screen */
+	TWeakPtr<SDockTab> DataTableTab;
+
+	/** A model change arrived while the grid was hidden and is applied on its next paint */
+	bool bModelChangeDeferred;
+
+	/** Whether a build since the deferred change recycled rows, see FEasyDataTableEditorModel::DidLastBuildReassignRows */
+	bool bDeferredRowsReassigned;
+
+	/** The rows were dropped by ReleaseCachedData and are rebuilt on the grid's next paint */
+	bool bCachedDataReleased;
+
+	/** Time the grid was first seen hidden, 0 while it is on screen */
+	double HiddenSinceTime;
+
+	FTSTicker::FDelegateHandle MemoryPolicyTickerHandle;
+
+	/** Selection and scroll position of the grid when its rows were released */
+	TArray<FName> ReleasedSelectedRowNames;
+	float ReleasedScrollOffset;
+
 	/** Property viewing widget */
 	TSharedPtr<class IDetailsView> PropertyView;
 
@@ -233,15 +417,37 @@ protected:
 	/** UI for the "Row Editor" tab */
 	TSharedPtr<SWidget> RowEditorTabWidget;
 
-	/** Array of the columns that are available for editing */
+	/** Cached rows and columns, shared with every other editor of this table */
+	TSharedPtr<class FEasyDataTableEditorModel> Model;
+
+	/** Array of the columns that are available for editing, copied from the model */
 	TArray<FEasyDataTableEditorColumnHeaderDataPtr> AvailableColumns;
 
-	/** Array of the rows that are available for editing */
+	/** Array of the rows that are available for editing, copied from the model */
 	TArray<FEasyDataTableEditorRowListViewDataPtr> AvailableRows;
 
 	/** Array of the rows that match the active filter(s) */
 	TArray<FEasyDataTableEditorRowListViewDataPtr> VisibleRows;
 
+	/** Rows of AvailableRows that are in VisibleRows, indexed by row slot */
+	TBitArray<> VisibleRowMask;
+
+	/** Index into VisibleRows of each row, indexed by row slot. Rows are found by name through the model */
+	TArray<int32> VisibleRowIndices;
+
+	/**
+	 * Rows of AvailableRows that are selected, indexed by row slot. The list view only tracks the highlighted
+	 * row; ctrl and shift selection is kept here so that selecting or inverting every row stays a bitwise operation.
+	 */
+	TBitArray<> SelectedRowMask;
+
+	/** Slot of the row shift-selection extends from */
+	int32 SelectionAnchorRowIndex;
+
+	/** Cell to edit once its row was scrolled into view, see BeginCellEdit */
+	FEasyDataTableEditorRowListViewDataPtr PendingCellEditRow;
+	int32 PendingCellEditColumnIndex;
+
 	/** Header row containing entries for each column in AvailableColumns */
 	TSharedPtr<SHeaderRow> ColumnNamesHeaderRow;
 
@@ -269,6 +475,32 @@ protected:
 	/** The current filter text applied to the data table */
 	FText ActiveFilterText;
 
+	/** Import running in the background, if any */
+	TSharedPtr<FEasyDataTableImporter> ActiveImport;
+
+	/** Timings of the last refresh */
+	FRefreshStats LastRefreshStats;
+
+	/** Whether the performance strip under the grid is shown */
+	bool bShowPerformanceStats;
+
+	/** Side panel filtering rows by the values of low-cardinality columns */
+	TSharedPtr<class SEasyDataTableFacetPanel> FacetPanel;
+
+	/** Whether the facet panel is shown, its filter only applies while it is */
+	bool bShowFacetPanel;
+
+	/** The performance strip text is only rebuilt when one of its inputs changed */
+	mutable FText CachedPerformanceStatsText;
+	mutable int32 CachedNumGeneratedRowWidgets;
+	mutable bool bPerformanceStatsTextDirty;
+
+	/** Columns hidden through the column header menu */
+	TSet<FName> HiddenColumnIds;
+
+	/** Display order of the columns set through the column header menu, empty for struct order */
+	TArray<FName> ColumnOrder;
+
 	/** Currently selected sorting mode */
 	EColumnSortMode::Type SortMode;
 
@@ -279,6 +511,8 @@ protected:
 
 	FSimpleDelegate CallbackOnDataTableUndoRedo;
 
+	FSimpleDelegate CallbackOnSelectedRowsChanged;
+
 	/**	The tab id for the data table tab */
 	static const FName DataTableTabId;
 
@@ -294,6 +528,9 @@ protected:
 	/** The column id for the row number list view column */
 	static const FName RowNumberColumnId;
 
+	/** The column id for the modified-from-default marker column */
+	static const FName RowModifiedColumnId;
+
 	/** The column id for the drag drop column */
 	static const FName RowDragDropColumnId;
 	friend FEasyDataTableEditorUtils;
@@ -0,0 +1,616 @@
+#include "EasyDataTableEditorModel.h"
+
+#include "Async/Async.h"
+#include "DataTableUtils.h"
+#include "EasyDataTableCacheBuilder.h"
+#include "EasyDataTableCellMeasurer.h"
+#include "EasyDataTableColumnSummary.h"
+#include "EasyDataTableEditorStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "Hash/xxhash.h"
+#include "Editor.h"
+#include "Engine/DataTable.h"
+#include "Engine/UserDefinedStruct.h"
+
+namespace EasyDataTableEditorModel
+{
+	/** Tables with more rows are cached progressively */
+	static constexpr int32 MinRowsForProgressiveBuild = 5000;
+
+	/** Rows cached before the editor opens, enough to fill the first screen */
+	static constexpr int32 FirstBuildRows = 200;
+
+	/** Rows cached between two checks of the time budget */
+	static constexpr int32 BuildChunkRows = 64;
+
+	/** Time spent caching rows per tick */
+	static constexpr double BuildTickBudgetSeconds = 0.008;
+
+	/** The editors refilter and resort on every notification, so appended rows are handed over in batches */
+	static constexpr double BuildBroadcastIntervalSeconds = 0.5;
+}
+
+TMap<FObjectKey, TWeakPtr<FEasyDataTableEditorModel>> FEasyDataTableEditorModel::Models;
+
+static FAutoConsoleCommandWithOutputDevice DumpMemoryCommand(
+	TEXT("EasyDataTableEditor.DumpMemory"),
+	TEXT("Lists the row and cache memory of every table open in the Easy Data Table Editor"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FEasyDataTableEditorModel::DumpMemoryReport));
+
+TSharedRef<FEasyDataTableEditorModel> FEasyDataTableEditorModel::FindOrCreate(UDataTable* Table)
+{
+	check(IsInGameThread());
+
+	TWeakPtr<FEasyDataTableEditorModel>& WeakModel = Models.FindOrAdd(FObjectKey(Table));
+	if (TSharedPtr<FEasyDataTableEditorModel> Model = WeakModel.Pin())
+	{
+		return Model.ToSharedRef();
+	}
+
+	TSharedRef<FEasyDataTableEditorModel> Model = MakeShareable(new FEasyDataTableEditorModel(Table));
+	WeakModel = Model;
+	return Model;
+}
+
+FEasyDataTableEditorModel::FEasyDataTableEditorModel(UDataTable* InTable)
+	: Table(InTable)
+{
+	GEditor->RegisterForUndo(this);
+	TableChangedHandle = InTable->OnDataTableChanged().AddRaw(this, &FEasyDataTableEditorModel::HandleTableChanged);
+}
+
+FEasyDataTableEditorModel::~FEasyDataTableEditorModel()
+{
+	CancelBuild();
+
+	if (GEditor)
+	{
+		GEditor->UnregisterForUndo(this);
+	}
+
+	if (UDataTable* DataTable = Table.Get())
+	{
+		DataTable->OnDataTableChanged().Remove(TableChangedHandle);
+	}
+
+	// Drop expired entries, this model's included
+	for (auto It = Models.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FEasyDataTableEditorModel::Refresh()
+{
+	// A released cache is built from the current table when it is next needed
+	if (!bHasBuiltCache)
+	{
+		return;
+	}
+
+	RebuildCache();
+	ModelChangedDelegate.Broadcast();
+}
+
+void FEasyDataTableEditorModel::ReleaseCache()
+{
+	if (!bHasBuiltCache)
+	{
+		return;
+	}
+
+	CancelBuild();
+
+	for (const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData : Columns)
+	{
+		ColumnData->EmptyCells();
+	}
+	Rows.Empty();
+	RowArena.Empty();
+	RowIndexByName.Empty();
+	RowNameIndex = FEasyDataTableRowNameIndex();
+	RowsComparedToDefault.Empty();
+	RowsDifferingFromDefault.Empty();
+	NumericColumns.Empty();
+	ColumnSummaries.Empty();
+
+	bHasBuiltCache = false;
+	bCacheReleased = true;
+	bLastChangeAppendedRows = false;
+	ModelChangedDelegate.Broadcast();
+}
+
+void FEasyDataTableEditorModel::BuildIfNeeded()
+{
+	if (!bHasBuiltCache)
+	{
+		RebuildCache();
+	}
+}
+
+void FEasyDataTableEditorModel::SetCellMeasurer(TSharedPtr<const IEasyDataTableCellMeasurer> InCellMeasurer)
+{
+	if (CellMeasurer == InCellMeasurer)
+	{
+		return;
+	}
+
+	CellMeasurer = MoveTemp(InCellMeasurer);
+	if (bHasBuiltCache)
+	{
+		RebuildCache();
+	}
+}
+
+void FEasyDataTableEditorModel::RebuildCache()
+{
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_CellCache);
+	const UDataTable* DataTable = Table.Get();
+
+	// A rebuild that interrupts a progressive build starts a new one, the rows past the cached ones are not known yet
+	const bool bWasBuilding = IsBuilding();
+	CancelBuild();
+	bTableChangedWhileBuilding = false;
+
+	if (DataTable && DataTable->RowStruct && (!bHasBuiltCache || bWasBuilding) && DataTable->GetRowMap().Num() > EasyDataTableEditorModel::MinRowsForProgressiveBuild)
+	{
+		CacheBuilder = MakeUnique<FEasyDataTableCacheBuilder>(DataTable->RowStruct, DataTable->GetRowMap(), RowArena, Columns, Rows, CellMeasurer.Get(), FEasyDataTableEditorUtils::GetPersistentCacheName(DataTable));
+		CacheBuilder->BuildRows(EasyDataTableEditorModel::FirstBuildRows);
+		bLastBuildReassignedRows = CacheBuilder->DidReassignRows();
+		LastCacheTimings = FEasyDataTableEditorCacheTimings();
+		LastBuildBroadcastTime = FPlatformTime::Seconds();
+		BuildTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FEasyDataTableEditorModel::HandleBuildTicker));
+	}
+	else
+	{
+		bLastBuildReassignedRows = FEasyDataTableEditorUtils::CacheDataTableForEditing(DataTable, RowArena, Columns, Rows, &LastCacheTimings, CellMeasurer.Get());
+	}
+	bHasBuiltCache = true;
+	bLastChangeAppendedRows = false;
+
+	// Widgets made before the release point at freed rows
+	bLastBuildReassignedRows |= bCacheReleased;
+	bCacheReleased = false;
+
+	RowIndexByName.Reset();
+	RowsComparedToDefault.Reset();
+	RowsDifferingFromDefault.Reset();
+	IndexRows(0);
+
+	// Reuse the value arrays of columns that are still numeric. They are read straight from the row map, so they cover
+	// every row even while a progressive build runs
+	int32 NumNumericColumns = 0;
+	for (int32 ColumnIndex = 0; DataTable && ColumnIndex < Columns.Num(); ++ColumnIndex)
+	{
+		const FProperty* Property = Columns[ColumnIndex]->Property;
+		if (FEasyDataTableNumericColumn::IsNumericProperty(Property))
+		{
+			if (!NumericColumns.IsValidIndex(NumNumericColumns))
+			{
+				NumericColumns.AddDefaulted();
+			}
+
+			FEasyDataTableNumericColumn& NumericColumn = NumericColumns[NumNumericColumns++];
+			NumericColumn.ColumnIndex = ColumnIndex;
+			NumericColumn.Build(Property, DataTable->GetRowMap());
+		}
+	}
+	NumericColumns.SetNum(NumNumericColumns);
+
+	// Summaries stay valid as long as their column holds the same cells
+	for (auto It = ColumnSummaries.CreateIterator(); It; ++It)
+	{
+		const FName ColumnId = It.Key();
+		const int32 ColumnIndex = Columns.IndexOfByPredicate([ColumnId](const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData)
+		{
+			return ColumnData->ColumnId == ColumnId;
+		});
+
+		if (ColumnIndex == INDEX_NONE || HashColumnContent(ColumnIndex) != It.Value().ContentHash)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FEasyDataTableEditorModel::IndexRows(int32 FirstRowIndex)
+{
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Indices);
+	RowIndexByName.Reserve(Rows.Num());
+	for (int32 RowIndex = FirstRowIndex; RowIndex < Rows.Num(); ++RowIndex)
+	{
+		RowIndexByName.Add(Rows[RowIndex]->RowId, RowIndex);
+	}
+	RowNameIndex.Reset();
+
+	// Only user defined structs have defaults to differ from
+	const bool bHasStructDefaults = Table.IsValid() && Cast<const UUserDefinedStruct>(Table->RowStruct) != nullptr;
+	RowsComparedToDefault.SetNum(Rows.Num(), !bHasStructDefaults);
+	RowsDifferingFromDefault.SetNum(Rows.Num(), false);
+}
+
+void FEasyDataTableEditorModel::HandleTableChanged()
+{
+	// Checked on the next tick: cell edits broadcast too, and only a change to the row map invalidates the build
+	if (IsBuilding())
+	{
+		bTableChangedWhileBuilding = true;
+	}
+}
+
+bool FEasyDataTableEditorModel::HandleBuildTicker(float DeltaTime)
+{
+	const UDataTable* DataTable = Table.Get();
+
+	// The builder holds the rows of the row map it was made from, which may have been freed since. Changes that go
+	// through the utils refresh the model right away; others only show up as a broadcast of the table or a new count
+	const bool bTableChanged = bTableChangedWhileBuilding;
+	bTableChangedWhileBuilding = false;
+	if (!DataTable || DataTable->GetRowMap().Num() != CacheBuilder->GetNumRows() || (bTableChanged && !CacheBuilder->MatchesRowMap()))
+	{
+		// Returning false removes this ticker, a refresh starts another build
+		BuildTickerHandle.Reset();
+		if (DataTable)
+		{
+			Refresh();
+		}
+		else
+		{
+			CacheBuilder.Reset();
+		}
+		return false;
+	}
+
+	const int32 FirstNewRowIndex = Rows.Num();
+	const double EndTime = FPlatformTime::Seconds() + EasyDataTableEditorModel::BuildTickBudgetSeconds;
+	bool bIsDone = false;
+	do
+	{
+		bIsDone = CacheBuilder->BuildRows(EasyDataTableEditorModel::BuildChunkRows);
+	}
+	while (!bIsDone && FPlatformTime::Seconds() < EndTime);
+
+	IndexRows(FirstNewRowIndex);
+	bLastBuildReassignedRows = CacheBuilder->DidReassignRows();
+
+	if (bIsDone)
+	{
+		CacheBuilder->Finish(&LastCacheTimings);
+		CacheBuilder.Reset();
+		BuildTickerHandle.Reset();
+
+		// Summaries requested while rows were missing are computed again
+		ColumnSummaries.Reset();
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (bIsDone || CurrentTime - LastBuildBroadcastTime >= EasyDataTableEditorModel::BuildBroadcastIntervalSeconds)
+	{
+		LastBuildBroadcastTime = CurrentTime;
+		bLastChangeAppendedRows = true;
+		ModelChangedDelegate.Broadcast();
+	}
+
+	return !bIsDone;
+}
+
+void FEasyDataTableEditorModel::CancelBuild()
+{
+	if (BuildTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(BuildTickerHandle);
+		BuildTickerHandle.Reset();
+	}
+	CacheBuilder.Reset();
+}
+
+int32 FEasyDataTableEditorModel::GetNumRowsToBuild() const
+{
+	return CacheBuilder.IsValid() ? CacheBuilder->GetNumRows() : Rows.Num();
+}
+
+void FEasyDataTableEditorModel::RefreshCell(int32 RowIndex, int32 ColumnIndex)
+{
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_CellCache);
+	const UDataTable* DataTable = Table.Get();
+	const uint8* RowData = DataTable ? DataTable->FindRowUnchecked(Rows[RowIndex]->RowId) : nullptr;
+	if (!RowData)
+	{
+		return;
+	}
+
+	FEasyDataTableEditorColumnHeaderData& ColumnData = *Columns[ColumnIndex];
+	ColumnData.SetCellString(Rows[RowIndex]->CellIndex, DataTableUtils::GetPropertyValueAsText(ColumnData.Property, RowData).ToString());
+
+	for (FEasyDataTableNumericColumn& NumericColumn : NumericColumns)
+	{
+		if (NumericColumn.ColumnIndex == ColumnIndex)
+		{
+			NumericColumn.UpdateValue(ColumnData.Property, RowIndex, RowData);
+			break;
+		}
+	}
+
+	// Compared again on next request, see DoesRowDifferFromDefault
+	if (Cast<const UUserDefinedStruct>(DataTable->RowStruct))
+	{
+		RowsComparedToDefault[RowIndex] = false;
+	}
+
+	ColumnSummaries.Remove(ColumnData.ColumnId);
+}
+
+uint64 FEasyDataTableEditorModel::HashColumnContent(int32 ColumnIndex) const
+{
+	const FEasyDataTableEditorColumnHeaderData& ColumnData = *Columns[ColumnIndex];
+
+	FXxHash64Builder Builder;
+	Builder.Update(&ColumnData.Property, sizeof(ColumnData.Property));
+	Builder.Update(ColumnData.RowCellIds.GetData(), ColumnData.RowCellIds.NumBytes());
+	for (const FString& CellString : ColumnData.CellStrings)
+	{
+		Builder.Update(*CellString, CellString.Len() * sizeof(TCHAR));
+		Builder.Update(TEXT(""), sizeof(TCHAR));
+	}
+	return Builder.Finalize().Hash;
+}
+
+bool FEasyDataTableEditorModel::GetColumnSummaryText(int32 ColumnIndex, FText& OutSummaryText)
+{
+	check(IsInGameThread());
+
+	if (!Columns.IsValidIndex(ColumnIndex) || !FEasyDataTableColumnSummary::HasSummary(Columns[ColumnIndex]->Property))
+	{
+		return false;
+	}
+
+	// Summaries wait for every row to be cached
+	if (IsBuilding())
+	{
+		OutSummaryText = FText::GetEmpty();
+		return true;
+	}
+
+	const FEasyDataTableEditorColumnHeaderData& ColumnData = *Columns[ColumnIndex];
+	if (const FColumnSummaryEntry* Entry = ColumnSummaries.Find(ColumnData.ColumnId))
+	{
+		OutSummaryText = Entry->Text;
+		return true;
+	}
+
+	const uint64 ContentHash = HashColumnContent(ColumnIndex);
+	FColumnSummaryEntry& Entry = ColumnSummaries.Add(ColumnData.ColumnId);
+	Entry.ContentHash = ContentHash;
+	OutSummaryText = FText::GetEmpty();
+
+	// The worker gets copies, the cache may be rebuilt while it runs
+	const FEasyDataTableNumericColumn* NumericColumn = FindNumericColumn(ColumnIndex);
+	TArray<double> Values = NumericColumn ? NumericColumn->Values : TArray<double>();
+	TArray<uint32> RowCellIds = NumericColumn ? TArray<uint32>() : ColumnData.RowCellIds;
+	const bool bIsNumeric = NumericColumn != nullptr;
+	const int32 NumCellIds = ColumnData.CellStrings.Num();
+
+	TWeakPtr<FEasyDataTableEditorModel> WeakModel = AsShared();
+	const FName ColumnId = ColumnData.ColumnId;
+	Async(EAsyncExecution::ThreadPool, [WeakModel, ColumnId, ContentHash, bIsNumeric, NumCellIds, Values = MoveTemp(Values), RowCellIds = MoveTemp(RowCellIds)]() mutable
+	{
+		FEasyDataTableColumnSummary Summary = bIsNumeric
+			? FEasyDataTableColumnSummary::ComputeNumeric(MoveTemp(Values))
+			: FEasyDataTableColumnSummary::ComputeFrequencies(RowCellIds, NumCellIds);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakModel, ColumnId, ContentHash, Summary = MoveTemp(Summary)]()
+		{
+			TSharedPtr<FEasyDataTableEditorModel> Model = WeakModel.Pin();
+			FColumnSummaryEntry* Entry = Model.IsValid() ? Model->ColumnSummaries.Find(ColumnId) : nullptr;
+			if (!Entry || Entry->ContentHash != ContentHash)
+			{
+				return;
+			}
+
+			const int32 ColumnIndex = Model->Columns.IndexOfByPredicate([ColumnId](const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData)
+			{
+				return ColumnData->ColumnId == ColumnId;
+			});
+			if (ColumnIndex != INDEX_NONE)
+			{
+				Entry->Text = Summary.ToText(*Model->Columns[ColumnIndex]);
+			}
+		});
+	});
+
+	return true;
+}
+
+int32 FEasyDataTableEditorModel::FindRowIndex(FName RowName) const
+{
+	const int32* RowIndex = RowIndexByName.Find(RowName);
+	return RowIndex ? *RowIndex : INDEX_NONE;
+}
+
+const FEasyDataTableRowNameIndex& FEasyDataTableEditorModel::GetRowNameIndex()
+{
+	BuildIfNeeded();
+	if (!RowNameIndex.IsBuilt())
+	{
+		RowNameIndex.Build(Rows);
+	}
+	return RowNameIndex;
+}
+
+bool FEasyDataTableEditorModel::DoesRowDifferFromDefault(int32 RowIndex)
+{
+	if (!RowsComparedToDefault.IsValidIndex(RowIndex))
+	{
+		return false;
+	}
+
+	if (!RowsComparedToDefault[RowIndex])
+	{
+		RowsComparedToDefault[RowIndex] = true;
+		RowsDifferingFromDefault[RowIndex] = FEasyDataTableEditorUtils::DiffersFromDefault(Table.Get(), Rows[RowIndex]->RowId);
+	}
+	return RowsDifferingFromDefault[RowIndex];
+}
+
+const TBitArray<>& FEasyDataTableEditorModel::GetRowsDifferingFromDefault()
+{
+	for (int32 RowIndex = RowsComparedToDefault.Find(false); RowIndex != INDEX_NONE; RowIndex = RowsComparedToDefault.FindFrom(false, RowIndex + 1))
+	{
+		DoesRowDifferFromDefault(RowIndex);
+	}
+	return RowsDifferingFromDefault;
+}
+
+const FEasyDataTableNumericColumn* FEasyDataTableEditorModel::FindNumericColumn(int32 ColumnIndex) const
+{
+	return NumericColumns.FindByPredicate([ColumnIndex](const FEasyDataTableNumericColumn& NumericColumn)
+	{
+		return NumericColumn.ColumnIndex == ColumnIndex;
+	});
+}
+
+SIZE_T FEasyDataTableEditorModel::GetAllocatedSize() const
+{
+	return GetCacheAllocatedSize() + GetIndexAllocatedSize();
+}
+
+SIZE_T FEasyDataTableEditorModel::GetCacheAllocatedSize() const
+{
+	SIZE_T AllocatedSize = Columns.GetAllocatedSize() + Rows.GetAllocatedSize() + RowArena.GetAllocatedSize();
+	AllocatedSize += Columns.Num() * sizeof(FEasyDataTableEditorColumnHeaderData);
+
+	for (const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData : Columns)
+	{
+		AllocatedSize += ColumnData->GetCellsAllocatedSize();
+	}
+
+	return AllocatedSize;
+}
+
+SIZE_T FEasyDataTableEditorModel::GetIndexAllocatedSize() const
+{
+	SIZE_T AllocatedSize = RowIndexByName.GetAllocatedSize() + RowNameIndex.GetAllocatedSize();
+	AllocatedSize += RowsComparedToDefault.GetAllocatedSize() + RowsDifferingFromDefault.GetAllocatedSize();
+
+	AllocatedSize += NumericColumns.GetAllocatedSize();
+	for (const FEasyDataTableNumericColumn& NumericColumn : NumericColumns)
+	{
+		AllocatedSize += NumericColumn.Values.GetAllocatedSize();
+	}
+
+	return AllocatedSize;
+}
+
+void FEasyDataTableEditorModel::DumpMemoryReport(FOutputDevice& Ar)
+{
+	Ar.Logf(TEXT("%-64s %10s %10s %14s %14s %14s  %s"), TEXT("Table"), TEXT("StructSize"), TEXT("Rows"), TEXT("RowBytes"), TEXT("CacheBytes"), TEXT("IndexBytes"), TEXT("State"));
+
+	uint64 TotalRowBytes = 0;
+	uint64 TotalCacheBytes = 0;
+	uint64 TotalIndexBytes = 0;
+	for (const TPair<FObjectKey, TWeakPtr<FEasyDataTableEditorModel>>& Entry : Models)
+	{
+		const TSharedPtr<FEasyDataTableEditorModel> Model = Entry.Value.Pin();
+		const UDataTable* DataTable = Model.IsValid() ? Model->Table.Get() : nullptr;
+		if (!DataTable)
+		{
+			continue;
+		}
+
+		// Inline size of the row structs, memory the row properties own on the heap is not included
+		const int32 StructSize = DataTable->RowStruct ? DataTable->RowStruct->GetStructureSize() : 0;
+		const int32 NumRows = DataTable->GetRowMap().Num();
+		const uint64 RowBytes = static_cast<uint64>(StructSize) * NumRows;
+		const uint64 CacheBytes = Model->GetCacheAllocatedSize();
+		const uint64 IndexBytes = Model->GetIndexAllocatedSize();
+
+		FString State;
+		if (Model->IsBuilding())
+		{
+			State = FString::Printf(TEXT("Building %d/%d"), Model->GetRows().Num(), Model->GetNumRowsToBuild());
+		}
+		else if (!Model->HasBuiltCache())
+		{
+			State = Model->bCacheReleased ? TEXT("Released") : TEXT("NotBuilt");
+		}
+		else
+		{
+			State = TEXT("Cached");
+		}
+
+		Ar.Logf(TEXT("%-64s %10d %10d %14llu %14llu %14llu  %s"), *DataTable->GetPathName(), StructSize, NumRows, RowBytes, CacheBytes, IndexBytes, *State);
+
+		TotalRowBytes += RowBytes;
+		TotalCacheBytes += CacheBytes;
+		TotalIndexBytes += IndexBytes;
+	}
+
+	Ar.Logf(TEXT("%-64s %10s %10s %14llu %14llu %14llu"), TEXT("Total"), TEXT(""), TEXT(""), TotalRowBytes, TotalCacheBytes, TotalIndexBytes);
+}
+
+void FEasyDataTableEditorModel::PostUndo(bool bSuccess)
+{
+	if (Table.IsValid())
+	{
+		Refresh();
+	}
+}
+
+void FEasyDataTableEditorModel::PostRedo(bool bSuccess)
+{
+	if (Table.IsValid())
+	{
+		Refresh();
+	}
+}
+
+void FEasyDataTableEditorModel::PreChange(const class UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info)
+{
+}
+
+void FEasyDataTableEditorModel::PostChange(const class UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info)
+{
+	const UDataTable* DataTable = Table.Get();
+	if (Struct && DataTable && (DataTable->GetRowStruct() == Struct))
+	{
+		Refresh();
+	}
+}
+
+void FEasyDataTableEditorModel::PreChange(const UDataTable* Changed, FEasyDataTableEditorUtils::EDataTableChangeInfo Info)
+{
+}
+
+void FEasyDataTableEditorModel::PostChange(const UDataTable* Changed, FEasyDataTableEditorUtils::EDataTableChangeInfo Info)
+{
+	if (Changed && Changed == Table.Get())
+	{
+		Refresh();
+	}
+}
+
+void FEasyDataTableEditorModel::CellChange(const UDataTable* Changed, FName RowName, FName ColumnId)
+{
+	if (!Changed || Changed != Table.Get() || !bHasBuiltCache)
+	{
+		return;
+	}
+
+	const int32 RowIndex = FindRowIndex(RowName);
+	const int32 ColumnIndex = Columns.IndexOfByPredicate([ColumnId](const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData)
+	{
+		return ColumnData->ColumnId == ColumnId;
+	});
+
+	if (RowIndex == INDEX_NONE || ColumnIndex == INDEX_NONE)
+	{
+		Refresh();
+		return;
+	}
+
+	RefreshCell(RowIndex, ColumnIndex);
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "EasyDataTableEditorUtils.h"
+#include "EasyDataTableNumericColumn.h"
+#include "EasyDataTableRowNameIndex.h"
+#include "EditorUndoClient.h"
+#include "Kismet2/StructureEditorUtils.h"
+#include "UObject/ObjectKey.h"
+
+class FEasyDataTableCacheBuilder;
+class IEasyDataTableCellMeasurer;
+class UDataTable;
+
+/**
+ * Cached rows and columns of a table, shared by every editor that has the table open.
+ * The model listens for table, row struct and undo/redo changes and rebuilds its cache once per change,
+ * then tells the editors, which only rebuild their own view state (filter, sort, selection).
+ *
+ * Large tables are opened with their first rows only. The other rows are cached in time-sliced chunks on the
+ * core ticker and appended to GetRows(), with the editors notified every so often while the build runs.
+ */
+class EASYDATATABLEEDITOR_API FEasyDataTableEditorModel
+	: public TSharedFromThis<FEasyDataTableEditorModel>
+	, public FEditorUndoClient
+	, public FStructureEditorUtils::INotifyOnStructChanged
+	, public FEasyDataTableEditorUtils::INotifyOnDataTableChanged
+{
+public:
+	DECLARE_MULTICAST_DELEGATE(FOnModelChanged);
+
+	/** Returns the model of a table, creating it if no editor holds one */
+	static TSharedRef<FEasyDataTableEditorModel> FindOrCreate(UDataTable* Table);
+
+	virtual ~FEasyDataTableEditorModel();
+
+	/** Rebuilds the cache from the table and notifies the editors, if the cache is built */
+	void Refresh();
+
+	/** Builds the cache if it has never been built, without notifying the editors. A large table only gets its first rows */
+	void BuildIfNeeded();
+
+	/**
+	 * Sets what sizes the columns and rows for the grid. The model starts without one, so users that only need the
+	 * data (the row editor, commandlets) never touch Slate; a built cache is rebuilt with the new measurer, without
+	 * notifying the editors.
+	 */
+	void SetCellMeasurer(TSharedPtr<const IEasyDataTableCellMeasurer> InCellMeasurer);
+
+	/** False until the first BuildIfNeeded and after ReleaseCache; Refresh does nothing then */
+	bool HasBuiltCache() const { return bHasBuiltCache; }
+
+	/**
+	 * Frees the cached rows, cells and indices of a table no editor shows; the next BuildIfNeeded builds them again.
+	 * The editors are notified and must drop their row pointers, the rows of the next build live at other addresses.
+	 */
+	void ReleaseCache();
+
+	/** True while the rows of a large table are still being cached, GetRows() then holds the rows cached so far */
+	bool IsBuilding() const { return CacheBuilder.IsValid(); }
+
+	/** Number of rows GetRows() will hold once the build is done */
+	int32 GetNumRowsToBuild() const;
+
+	/** True if the last change only appended rows cached by a progressive build, so the editors keep their sort */
+	bool DidLastChangeAppendRows() const { return bLastChangeAppendedRows; }
+
+	const TArray<FEasyDataTableEditorColumnHeaderDataPtr>& GetColumns() const { return Columns; }
+	const TArray<FEasyDataTableEditorRowListViewDataPtr>& GetRows() const { return Rows; }
+
+	/** Index of a row in GetRows(), or INDEX_NONE */
+	int32 FindRowIndex(FName RowName) const;
+
+	/** Search index over the row names, built on first use after each rebuild */
+	const FEasyDataTableRowNameIndex& GetRowNameIndex();
+
+	/**
+	 * Whether a row of a user defined struct table differs from the struct defaults. Each row is compared once
+	 * after every rebuild, on first request, so the result can be polled by widgets.
+	 */
+	bool DoesRowDifferFromDefault(int32 RowIndex);
+
+	/** DoesRowDifferFromDefault for every row, indexed like GetRows() */
+	const TBitArray<>& GetRowsDifferingFromDefault();
+
+	/** Values of a numeric column, or null if the column is not numeric */
+	const FEasyDataTableNumericColumn* FindNumericColumn(int32 ColumnIndex) const;
+
+	/**
+	 * Summary statistics of a column for its header tooltip. The first call computes them in the background and
+	 * leaves OutSummaryText empty; the result is kept until the content of the column changes.
+	 *
+	 * @return	False if the column has no summary
+	 */
+	bool GetColumnSummaryText(int32 ColumnIndex, FText& OutSummaryText);
+
+	const FEasyDataTableEditorCacheTimings& GetLastCacheTimings() const { return LastCacheTimings; }
+
+	/** True if the last rebuild recycled a row for a different table row, so row widgets must be regenerated */
+	bool DidLastBuildReassignRows() const { return bLastBuildReassignedRows; }
+
+	/** Memory used by the cached rows and columns, GetCacheAllocatedSize and GetIndexAllocatedSize together */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Memory used by the row view models and the cells of every column */
+	SIZE_T GetCacheAllocatedSize() const;
+
+	/** Memory used by the lookups over the rows: names, search index, default comparison and numeric values */
+	SIZE_T GetIndexAllocatedSize() const;
+
+	/**
+	 * Lists the memory of every table that has a model: row struct size, row count, raw row bytes, cache bytes and
+	 * index bytes. Run with the EasyDataTableEditor.DumpMemory console command.
+	 */
+	static void DumpMemoryReport(FOutputDevice& Ar);
+
+	/** Broadcast after the cache was rebuilt */
+	FOnModelChanged& OnModelChanged() { return ModelChangedDelegate; }
+
+	// FEditorUndoClient
+	virtual void PostUndo(bool bSuccess) override;
+	virtual void PostRedo(bool bSuccess) override;
+
+	// INotifyOnStructChanged
+	virtual void PreChange(const class UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info) override;
+	virtual void PostChange(const class UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info) override;
+
+	// INotifyOnDataTableChanged
+	virtual void PreChange(const UDataTable* Changed, FEasyDataTableEditorUtils::EDataTableChangeInfo Info) override;
+	virtual void PostChange(const UDataTable* Changed, FEasyDataTableEditorUtils::EDataTableChangeInfo Info) override;
+	virtual void CellChange(const UDataTable* Changed, FName RowName, FName ColumnId) override;
+
+private:
+	explicit FEasyDataTableEditorModel(UDataTable* InTable);
+
+	void RebuildCache();
+
+	/** Extends the per-row state (name lookup, default comparison) to the rows from FirstRowIndex on */
+	void IndexRows(int32 FirstRowIndex);
+
+	/** Bound to the table's OnDataTableChanged, flags a progressive build for a check of the row map */
+	void HandleTableChanged();
+
+	/** Caches the next rows of a progressive build within a time budget */
+	bool HandleBuildTicker(float DeltaTime);
+
+	void CancelBuild();
+
+	/**
+	 * Re-reads one cell of the cache after it was edited in place. Filter, sort and widgets stay as they are;
+	 * the cell widgets read their text through the model and pick up the new value on their next paint.
+	 */
+	void RefreshCell(int32 RowIndex, int32 ColumnIndex);
+
+	/** Hash of the cells of a column, used to tell whether its summary is still valid */
+	uint64 HashColumnContent(int32 ColumnIndex) const;
+
+	TWeakObjectPtr<UDataTable> Table;
+
+	/** Null until an editor shows the table, the cached sizes are 0 then */
+	TSharedPtr<const IEasyDataTableCellMeasurer> CellMeasurer;
+
+	TArray<FEasyDataTableEditorColumnHeaderDataPtr> Columns;
+	FEasyDataTableEditorRowArena RowArena;
+	TArray<FEasyDataTableEditorRowListViewDataPtr> Rows;
+	TMap<FName, int32> RowIndexByName;
+	FEasyDataTableRowNameIndex RowNameIndex;
+
+	/** Rows compared to the struct defaults since the last rebuild, and the result of the comparison */
+	TBitArray<> RowsComparedToDefault;
+	TBitArray<> RowsDifferingFromDefault;
+
+	/** One entry per int, float and double column */
+	TArray<FEasyDataTableNumericColumn> NumericColumns;
+
+	struct FColumnSummaryEntry
+	{
+		uint64 ContentHash = 0;
+
+		/** Empty until the background task finished */
+		FText Text;
+	};
+
+	/** Summaries requested so far, by column ID */
+	TMap<FName, FColumnSummaryEntry> ColumnSummaries;
+
+	FEasyDataTableEditorCacheTimings LastCacheTimings;
+
+	/** Progressive build of a large table, null once every row is cached */
+	TUniquePtr<FEasyDataTableCacheBuilder> CacheBuilder;
+	FTSTicker::FDelegateHandle BuildTickerHandle;
+	double LastBuildBroadcastTime = 0.0;
+	FDelegateHandle TableChangedHandle;
+
+	/** The table broadcast a change since the build started or last ticked */
+	bool bTableChangedWhileBuilding = false;
+
+	bool bHasBuiltCache = false;
+	bool bLastBuildReassignedRows = false;
+	bool bLastChangeAppendedRows = false;
+
+	/** Set by ReleaseCache, the next build reports every row as reassigned */
+	bool bCacheReleased = false;
+
+	FOnModelChanged ModelChangedDelegate;
+
+	/** Live models, the editors hold the strong references */
+	static TMap<FObjectKey, TWeakPtr<FEasyDataTableEditorModel>> Models;
+};
@@ -3,7 +3,6 @@
 #include "UObject/UObjectHash.h"
 #include "UObject/UObjectIterator.h"
 #include "Styling/SlateTypes.h"
-#include "Fonts/FontMeasure.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Framework/Application/SlateUser.h"
 #include "Styling/AppStyle.h"
@@ -18,7 +17,10 @@
 #include "Widgets/Input/SComboBox.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "DetailWidgetRow.h"
+#include "EasyDataTableCacheBuilder.h"
 #include "EasyDataTableEditor.h"
+#include "EasyDataTableEditorModel.h"
+#include "EasyDataTableEditorStats.h"
 #include "Editor.h"
 #include "SEasyRowEditor.h"
 #include "Utils/Steal.h"
@@ -33,6 +35,116 @@ void AddRowInternal(UDataTable* DataTable,FName RowName, uint8* RowDataPtr)
 {
 	Get_UDataTable_RowMap(DataTable).Add(RowName, RowDataPtr);
 }
+
+/** Row count used as metadata for the scoped cycle counters */
+static int32 GetNumRowsForStats(const UDataTable* DataTable)
+{
+	return DataTable ? DataTable->GetRowMap().Num() : 0;
+}
+
+/** Column count used as metadata for the scoped cycle counters */
+static int32 GetNumColumnsForStats(const UDataTable* DataTable)
+{
+	int32 NumColumns = 0;
+	if (DataTable && DataTable->RowStruct)
+	{
+		for (TFieldIterator<const FProperty> It(DataTable->RowStruct); It; ++It)
+		{
+			++NumColumns;
+		}
+	}
+	return NumColumns;
+}
+
+const FString FEasyDataTableEditorColumnHeaderData::EmptyCellString;
+
+FText FEasyDataTableEditorColumnHeaderData::GetCellText(int32 CellIndex) const
+{
+	if (!RowCellIds.IsValidIndex(CellIndex))
+	{
+		return FText::GetEmpty();
+	}
+
+	const uint32 CellId = RowCellIds[CellIndex];
+	if (!CellTexts.IsValidIndex(CellId))
+	{
+		CellTexts.SetNum(CellStrings.Num());
+	}
+
+	FText& CellText = CellTexts[CellId];
+	if (CellText.IsEmpty() && !CellStrings[CellId].IsEmpty())
+	{
+		CellText = FText::FromString(CellStrings[CellId]);
+	}
+	return CellText;
+}
+
+void FEasyDataTableEditorColumnHeaderData::SetCellString(int32 CellIndex, const FString& CellString)
+{
+	if (!RowCellIds.IsValidIndex(CellIndex))
+	{
+		return;
+	}
+
+	// A single edit, a scan is cheaper than keeping the formatter's lookup maps alive
+	int32 CellId = CellStrings.IndexOfByPredicate([&CellString](const FString& ExistingString)
+	{
+		return ExistingString.Equals(CellString, ESearchCase::CaseSensitive);
+	});
+	if (CellId == INDEX_NONE)
+	{
+		CellId = CellStrings.Add(CellString);
+	}
+	RowCellIds[CellIndex] = static_cast<uint32>(CellId);
+}
+
+void FEasyDataTableEditorColumnHeaderData::ResetCells(int32 NumRows)
+{
+	CellStrings.Reset();
+	CellTexts.Reset();
+	RowCellIds.Reset(NumRows);
+}
+
+void FEasyDataTableEditorColumnHeaderData::EmptyCells()
+{
+	CellStrings.Empty();
+	CellTexts.Empty();
+	RowCellIds.Empty();
+}
+
+SIZE_T FEasyDataTableEditorColumnHeaderData::GetCellsAllocatedSize() const
+{
+	SIZE_T AllocatedSize = CellStrings.GetAllocatedSize() + RowCellIds.GetAllocatedSize() + CellTexts.GetAllocatedSize();
+	for (const FString& CellString : CellStrings)
+	{
+		AllocatedSize += CellString.GetAllocatedSize();
+	}
+	return AllocatedSize;
+}
+
+FEasyDataTableEditorRowListViewData* FEasyDataTableEditorRowArena::GetRow(int32 SlotIndex)
+{
+	check(SlotIndex >= 0);
+
+	const int32 ChunkIndex = SlotIndex / RowsPerChunk;
+	while (Chunks.Num() <= ChunkIndex)
+	{
+		LLM_SCOPE_BYTAG(EasyDataTableEditor_RowViewModels);
+		Chunks.Add(MakeUnique<FEasyDataTableEditorRowListViewData[]>(RowsPerChunk));
+	}
+	return &Chunks[ChunkIndex][SlotIndex % RowsPerChunk];
+}
+
+void FEasyDataTableEditorRowArena::Empty()
+{
+	Chunks.Empty();
+}
+
+SIZE_T FEasyDataTableEditorRowArena::GetAllocatedSize() const
+{
+	return Chunks.GetAllocatedSize() + Chunks.Num() * RowsPerChunk * sizeof(FEasyDataTableEditorRowListViewData);
+}
+
 /** Combobox that allows selecting a struct row for a data table. Based off of SSearchableComboBox */
 class SEasyDataTableStructComboBox : public SComboButton
 {
@@ -467,6 +579,8 @@ FEasyDataTableEditorUtils::FEasyDataTableEditorManager& FEasyDataTableEditorUtil
 
 bool FEasyDataTableEditorUtils::RemoveRow(UDataTable* DataTable, FName Name)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_RemoveRow, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
 	bool bResult = false;
 	if (DataTable && DataTable->RowStruct)
 	{
@@ -492,6 +606,8 @@ bool FEasyDataTableEditorUtils::RemoveRow(UDataTable* DataTable, FName Name)
 
 uint8* FEasyDataTableEditorUtils::AddRow(UDataTable* DataTable, FName RowName)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_AddRow, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
 	if (!DataTable || (RowName == NAME_None) || (DataTable->GetRowMap().Find(RowName) != nullptr) || !DataTable->RowStruct)
 	{
 		return nullptr;
@@ -512,8 +628,234 @@ uint8* FEasyDataTableEditorUtils::AddRow(UDataTable* DataTable, FName RowName)
 	return RowData;
 }
 
+int32 FEasyDataTableEditorUtils::AddOrReplaceRows(UDataTable* DataTable, TArray<TPair<FName, uint8*>>& Rows, bool bRemoveOtherRows)
+{
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_AddOrReplaceRows, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
+	if (!DataTable || !DataTable->RowStruct)
+	{
+		return 0;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("AddOrReplaceDataTableRows", "Import Data Table Rows"));
+
+	BroadcastPreChange(DataTable, EDataTableChangeInfo::RowList);
+	DataTable->Modify();
+
+	TMap<FName, uint8*>& RowMap = Get_UDataTable_RowMap(DataTable);
+	if (bRemoveOtherRows)
+	{
+		for (const TPair<FName, uint8*>& Pair : RowMap)
+		{
+			DataTable->RowStruct->DestroyStruct(Pair.Value);
+			FMemory::Free(Pair.Value);
+		}
+		RowMap.Reset();
+	}
+	RowMap.Reserve(RowMap.Num() + Rows.Num());
+
+	int32 NumRows = 0;
+	for (TPair<FName, uint8*>& Row : Rows)
+	{
+		if (!Row.Value)
+		{
+			continue;
+		}
+
+		if (Row.Key == NAME_None)
+		{
+			// Owned like the other rows, but cannot be added
+			DataTable->RowStruct->DestroyStruct(Row.Value);
+			FMemory::Free(Row.Value);
+			Row.Value = nullptr;
+			continue;
+		}
+
+		if (uint8** ExistingRowData = RowMap.Find(Row.Key))
+		{
+			// Keep the existing allocation so the row stays in place
+			DataTable->RowStruct->CopyScriptStruct(*ExistingRowData, Row.Value);
+			DataTable->RowStruct->DestroyStruct(Row.Value);
+			FMemory::Free(Row.Value);
+		}
+		else
+		{
+			AddRowInternal(DataTable, Row.Key, Row.Value);
+		}
+		Row.Value = nullptr;
+		++NumRows;
+	}
+	Rows.Reset();
+
+	BroadcastPostChange(DataTable, EDataTableChangeInfo::RowList);
+	return NumRows;
+}
+
+int32 FEasyDataTableEditorUtils::RemoveRows(UDataTable* DataTable, TConstArrayView<FName> RowNames)
+{
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_RemoveRows, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
+	if (!DataTable || !DataTable->RowStruct || RowNames.IsEmpty())
+	{
+		return 0;
+	}
+
+	FScopedTransaction Transaction(LOCTEXT("RemoveDataTableRows", "Remove Data Table Rows"));
+
+	TMap<FName, uint8*>& RowMap = Get_UDataTable_RowMap(DataTable);
+	int32 NumRemoved = 0;
+	for (const FName Name : RowNames)
+	{
+		if (!RowMap.Contains(Name))
+		{
+			continue;
+		}
+
+		if (NumRemoved == 0)
+		{
+			BroadcastPreChange(DataTable, EDataTableChangeInfo::RowList);
+			DataTable->Modify();
+		}
+
+		uint8* RowData = nullptr;
+		RowMap.RemoveAndCopyValue(Name, RowData);
+		if (RowData)
+		{
+			DataTable->RowStruct->DestroyStruct(RowData);
+			FMemory::Free(RowData);
+		}
+		++NumRemoved;
+	}
+
+	if (NumRemoved > 0)
+	{
+		// Compact the map so that a subsequent add goes at the end of the table
+		RowMap.CompactStable();
+
+		BroadcastPostChange(DataTable, EDataTableChangeInfo::RowList);
+	}
+	else
+	{
+		Transaction.Cancel();
+	}
+	return NumRemoved;
+}
+
+int32 FEasyDataTableEditorUtils::RenameRows(UDataTable* DataTable, TConstArrayView<TPair<FName, FName>> Renames)
+{
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_RenameRows, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
+	if (!DataTable || Renames.IsEmpty())
+	{
+		return 0;
+	}
+
+	FScopedTransaction Transaction(LOCTEXT("RenameDataTableRows", "Rename Data Table Rows"));
+
+	TMap<FName, uint8*>& RowMap = Get_UDataTable_RowMap(DataTable);
+	int32 NumRenamed = 0;
+	for (const TPair<FName, FName>& Rename : Renames)
+	{
+		const bool bValidNewName = (Rename.Value != NAME_None) && !RowMap.Contains(Rename.Value);
+		if (!bValidNewName || !RowMap.Contains(Rename.Key))
+		{
+			continue;
+		}
+
+		if (NumRenamed == 0)
+		{
+			BroadcastPreChange(DataTable, EDataTableChangeInfo::RowList);
+			DataTable->Modify();
+		}
+
+		uint8* RowData = nullptr;
+		RowMap.RemoveAndCopyValue(Rename.Key, RowData);
+		RowMap.FindOrAdd(Rename.Value) = RowData;
+		++NumRenamed;
+	}
+
+	if (NumRenamed > 0)
+	{
+		BroadcastPostChange(DataTable, EDataTableChangeInfo::RowList);
+	}
+	else
+	{
+		Transaction.Cancel();
+	}
+	return NumRenamed;
+}
+
+int32 FEasyDataTableEditorUtils::SetColumnValues(UDataTable* DataTable, FName ColumnId, TConstArrayView<TPair<FName, FString>> Values, TArray<FString>& OutProblems)
+{
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_SetColumnValues, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
+	const FProperty* Property = (DataTable && DataTable->RowStruct) ? DataTable->RowStruct->FindPropertyByName(ColumnId) : nullptr;
+	if (!Property || Property->ArrayDim != 1)
+	{
+		OutProblems.Add(FString::Printf(TEXT("Column '%s' cannot be written"), *ColumnId.ToString()));
+		return 0;
+	}
+
+	// Same scratch value approach as SetCellValue, the table is only touched by values that import and differ
+	void* NewValue = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+	Property->InitializeValue(NewValue);
+
+	FScopedTransaction Transaction(LOCTEXT("SetDataTableColumnValues", "Set Data Table Column Values"));
+
+	int32 NumChanged = 0;
+	for (const TPair<FName, FString>& Value : Values)
+	{
+		uint8* RowData = DataTable->FindRowUnchecked(Value.Key);
+		if (!RowData)
+		{
+			OutProblems.Add(FString::Printf(TEXT("Row '%s' not found"), *Value.Key.ToString()));
+			continue;
+		}
+
+		Property->ClearValue(NewValue);
+		const FString Error = DataTableUtils::AssignStringToPropertyDirect(Value.Value, Property, static_cast<uint8*>(NewValue));
+		if (!Error.IsEmpty())
+		{
+			OutProblems.Add(FString::Printf(TEXT("Row '%s', column '%s': %s"), *Value.Key.ToString(), *ColumnId.ToString(), *Error));
+			continue;
+		}
+
+		void* ValuePtr = Property->ContainerPtrToValuePtr<void>(RowData);
+		if (Property->Identical(ValuePtr, NewValue, PPF_None))
+		{
+			continue;
+		}
+
+		if (NumChanged == 0)
+		{
+			BroadcastPreChange(DataTable, EDataTableChangeInfo::RowData);
+			DataTable->Modify();
+		}
+		Property->CopyCompleteValue(ValuePtr, NewValue);
+		++NumChanged;
+	}
+
+	if (NumChanged > 0)
+	{
+		DataTable->HandleDataTableChanged();
+		DataTable->MarkPackageDirty();
+		BroadcastPostChange(DataTable, EDataTableChangeInfo::RowData);
+	}
+	else
+	{
+		Transaction.Cancel();
+	}
+
+	Property->DestroyValue(NewValue);
+	FMemory::Free(NewValue);
+
+	return NumChanged;
+}
+
 uint8* FEasyDataTableEditorUtils::AddRowAboveOrBelowSelection(UDataTable* DataTable, const FName& RowName, const FName& NewRowName, ERowInsertionPosition InsertPosition)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_AddRowAboveOrBelowSelection, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
 	if (!DataTable || (NewRowName == NAME_None) || (DataTable->GetRowMap().Find(NewRowName) != nullptr) || !DataTable->RowStruct)
 	{
 		return nullptr;
@@ -574,6 +916,8 @@ uint8* FEasyDataTableEditorUtils::AddRowAboveOrBelowSelection(UDataTable* DataTa
 
 uint8* FEasyDataTableEditorUtils::DuplicateRow(UDataTable* DataTable, FName SourceRowName, FName RowName)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_DuplicateRow, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
 	
 	if (!DataTable || (SourceRowName == NAME_None) || !Get_UDataTable_RowMap(DataTable).Contains(SourceRowName) || Get_UDataTable_RowMap(DataTable).Contains(RowName) || !DataTable->RowStruct)
 	{
@@ -600,6 +944,8 @@ uint8* FEasyDataTableEditorUtils::DuplicateRow(UDataTable* DataTable, FName Sour
 
 bool FEasyDataTableEditorUtils::RenameRow(UDataTable* DataTable, FName OldName, FName NewName)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_RenameRow, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
 	bool bResult = false;
 	if (DataTable)
 	{
@@ -623,6 +969,8 @@ bool FEasyDataTableEditorUtils::RenameRow(UDataTable* DataTable, FName OldName,
 
 bool FEasyDataTableEditorUtils::MoveRow(UDataTable* DataTable, FName RowName, ERowMoveDirection Direction, int32 NumRowsToMoveBy)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_MoveRow, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
 	if (!DataTable)
 	{
 		return false;
@@ -699,6 +1047,8 @@ bool FEasyDataTableEditorUtils::MoveRow(UDataTable* DataTable, FName RowName, ER
 
 bool FEasyDataTableEditorUtils::SelectRow(const UDataTable* DataTable, FName RowName)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_SelectRow, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
 	for (auto Listener : FEasyDataTableEditorManager::Get().GetListeners())
 	{
 		static_cast<INotifyOnDataTableChanged*>(Listener)->SelectionChange(DataTable, RowName);
@@ -708,6 +1058,8 @@ bool FEasyDataTableEditorUtils::SelectRow(const UDataTable* DataTable, FName Row
 
 bool FEasyDataTableEditorUtils::DiffersFromDefault(UDataTable* DataTable, FName RowName)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_DiffersFromDefault, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
 	bool bDiffers = false;
 
 	if (DataTable && DataTable->GetRowMap().Contains(RowName))
@@ -725,6 +1077,8 @@ bool FEasyDataTableEditorUtils::DiffersFromDefault(UDataTable* DataTable, FName
 
 bool FEasyDataTableEditorUtils::ResetToDefault(UDataTable* DataTable, FName RowName)
 {
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_ResetToDefault, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
+
 	bool bResult = false;
 
 	if (DataTable && DataTable->GetRowMap().Contains(RowName))
@@ -748,171 +1102,169 @@ bool FEasyDataTableEditorUtils::ResetToDefault(UDataTable* DataTable, FName RowN
 	return bResult;
 }
 
-void FEasyDataTableEditorUtils::BroadcastPreChange(UDataTable* DataTable, EDataTableChangeInfo Info)
+bool FEasyDataTableEditorUtils::CanEditCellInline(const FProperty* Property)
 {
-	FEasyDataTableEditorManager::Get().PreChange(DataTable, Info);
-}
-
-void FEasyDataTableEditorUtils::BroadcastPostChange(UDataTable* DataTable, EDataTableChangeInfo Info)
-{
-	if (DataTable && (EDataTableChangeInfo::RowList == Info))
+	if (!Property || Property->ArrayDim != 1)
 	{
-		for (TObjectIterator<UK2Node_GetDataTableRow> It(RF_Transient | RF_ClassDefaultObject, /** bIncludeDerivedClasses */ true, /** InternalExcludeFlags */ EInternalObjectFlags::Garbage); It; ++It)
-		{
-			It->OnDataTableRowListChanged(DataTable);
-		}
+		return false;
 	}
-	FEasyDataTableEditorManager::Get().PostChange(DataTable, Info);
-	DataTable->OnDataTableChanged().Broadcast();
+
+	return Property->IsA<FNumericProperty>()
+		|| Property->IsA<FBoolProperty>()
+		|| Property->IsA<FEnumProperty>()
+		|| Property->IsA<FNameProperty>()
+		|| Property->IsA<FStrProperty>()
+		|| Property->IsA<FTextProperty>();
 }
 
-void FEasyDataTableEditorUtils::BroadcastPostRowPropertyChange(UDataTable* DataTable,
-	const FPropertyChangedEvent& PropertyChangedEvent, FProperty* PropertyThatChanged,
-	TSharedPtr<class SEasyRowEditor> EasyRowEditor)
+bool FEasyDataTableEditorUtils::PropertyNeedsGameThread(const FProperty* Property)
 {
-	//void** val = PropertyThatChanged->ContainerPtrToValuePtr<void*>(EasyRowEditor->CurrentRow->GetStructMemory());
-	//UE_LOG(LogTemp,Log,TEXT("Post PropertyName %s:%f"),*PropertyThatChanged->GetName(),*val)
-	bool bNeedRefresh = false;
-	if(EasyRowEditor->WeakEditor.IsValid())
-	{
-		auto Editor{EasyRowEditor->WeakEditor.Pin()};
-		//UE_LOG(LogTemp,Log,TEXT("HeightLight:%s"),*Editor->HighlightedRowName.ToString());
-		for(auto& Iter:Editor->CellsListView->GetSelectedItems())
+	if (Property->IsA<FObjectPropertyBase>())
+	{
+		// Soft references only parse or compare a path
+		return !Property->IsA<FSoftObjectProperty>();
+	}
+	if (Property->IsA<FInterfaceProperty>() || Property->IsA<FDelegateProperty>() || Property->IsA<FMulticastDelegateProperty>())
+	{
+		return true;
+	}
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		for (TFieldIterator<const FProperty> It(StructProperty->Struct); It; ++It)
 		{
-			if(Editor->HighlightedRowName == Iter->RowId)
-			{
-			}
-			else
+			if (PropertyNeedsGameThread(*It))
 			{
-				bNeedRefresh = true;
-				
-				TSharedPtr<FStructOnScope> BroadcastRow {MakeShareable(new FStructFromDataTable(DataTable, Iter->RowId))};
-				//PropertyThatChanged->CopySingleValue(BroadcastRow->GetStructMemory(),EasyRowEditor->CurrentRow->GetStructMemory());
-				PropertyThatChanged->CopyCompleteValue_InContainer(BroadcastRow->GetStructMemory(),EasyRowEditor->CurrentRow->GetStructMemory());
-				//void** valBro = PropertyThatChanged->ContainerPtrToValuePtr<void*>(BroadcastRow->GetStructMemory());
-				//UE_LOG(LogTemp,Log,TEXT("Item:%s : %f  -- Broadcast"),*Iter->RowId.ToString(),*valBro);
-				//*valBro = *val;
+				return true;
 			}
 		}
-		if(bNeedRefresh)
-		{
-			EasyRowEditor->WeakEditor.Pin()->HandlePostChange();
-			DataTable->Modify();
-		}
+		return false;
 	}
-	
-}
-
-void FEasyDataTableEditorUtils::CacheDataTableForEditing(const UDataTable* DataTable, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows)
-{
-	if (!DataTable || !DataTable->RowStruct)
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
 	{
-		OutAvailableColumns.Empty();
-		OutAvailableRows.Empty();
-		return;
+		return PropertyNeedsGameThread(ArrayProperty->Inner);
 	}
-
-	CacheDataForEditing(DataTable->RowStruct, DataTable->GetRowMap(), OutAvailableColumns, OutAvailableRows);
+	if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		return PropertyNeedsGameThread(SetProperty->ElementProp);
+	}
+	if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		return PropertyNeedsGameThread(MapProperty->KeyProp) || PropertyNeedsGameThread(MapProperty->ValueProp);
+	}
+	return false;
 }
 
-void FEasyDataTableEditorUtils::CacheDataForEditing(const UScriptStruct* RowStruct, const TMap<FName, uint8*>& RowMap, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows)
+bool FEasyDataTableEditorUtils::SetCellValue(UDataTable* DataTable, FName RowName, FName ColumnId, const FString& Value)
 {
-	TArray<FEasyDataTableEditorColumnHeaderDataPtr> OldColumns = OutAvailableColumns;
-	TArray<FEasyDataTableEditorRowListViewDataPtr> OldRows = OutAvailableRows;
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_SetCellValue, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
 
-	// First build array of properties
-	TArray<const FProperty*> StructProps;
-	for (TFieldIterator<const FProperty> It(RowStruct); It; ++It)
+	uint8* RowData = DataTable ? DataTable->FindRowUnchecked(RowName) : nullptr;
+	const FProperty* Property = (RowData && DataTable->RowStruct) ? DataTable->RowStruct->FindPropertyByName(ColumnId) : nullptr;
+	if (!CanEditCellInline(Property))
 	{
-		const FProperty* Prop = *It;
-		check(Prop);
-		if (!Prop->HasMetaData(FName(TEXT("HideFromDataTableEditorColumn"))))
-		{
-			StructProps.Add(Prop);
-		}
+		return false;
 	}
 
-	TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
-	const FTextBlockStyle& CellTextStyle = FAppStyle::GetWidgetStyle<FTextBlockStyle>("DataTableEditor.CellText");
-	static const float CellPadding = 10.0f;
+	// Import into a scratch value first, so an invalid or unchanged value neither dirties the table nor opens a transaction
+	void* NewValue = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+	Property->InitializeValue(NewValue);
 
-	// Populate the column data
-	OutAvailableColumns.Reset(StructProps.Num());
-	for (int32 Index = 0; Index < StructProps.Num(); ++Index)
+	void* ValuePtr = Property->ContainerPtrToValuePtr<void>(RowData);
+	const FString Error = DataTableUtils::AssignStringToPropertyDirect(Value, Property, static_cast<uint8*>(NewValue));
+	const bool bChanged = Error.IsEmpty() && !Property->Identical(ValuePtr, NewValue, PPF_None);
+	if (bChanged)
 	{
-		const FProperty* Prop = StructProps[Index];
-		const FText PropertyDisplayName = DataTableUtils::GetPropertyDisplayName(Prop, FName::NameToDisplayString(Prop->GetName(), Prop->IsA<FBoolProperty>()));
+		const FScopedTransaction Transaction(LOCTEXT("SetDataTableCellValue", "Set Data Table Cell Value"));
 
-		FEasyDataTableEditorColumnHeaderDataPtr CachedColumnData;
-		
-		// If at all possible, attempt to reuse previous columns if their data has not changed
-		if (Index >= OldColumns.Num() || OldColumns[Index]->ColumnId != Prop->GetFName() || !OldColumns[Index]->DisplayName.EqualTo(PropertyDisplayName))
+		DataTable->Modify();
+		Property->CopyCompleteValue(ValuePtr, NewValue);
+
+		// Also broadcasts OnDataTableChanged to the table listeners
+		DataTable->HandleDataTableChanged(RowName);
+		DataTable->MarkPackageDirty();
+
+		for (auto Listener : FEasyDataTableEditorManager::Get().GetListeners())
 		{
-			CachedColumnData = MakeShareable(new FEasyDataTableEditorColumnHeaderData());
-			CachedColumnData->ColumnId = Prop->GetFName();
-			CachedColumnData->DisplayName = PropertyDisplayName;
-			CachedColumnData->Property = Prop;
+			static_cast<INotifyOnDataTableChanged*>(Listener)->CellChange(DataTable, RowName, ColumnId);
 		}
-		else
-		{
-			CachedColumnData = OldColumns[Index];
+	}
 
-			// Need to update property hard pointer in case it got reconstructed
-			CachedColumnData->Property = Prop;
-		}
+	Property->DestroyValue(NewValue);
+	FMemory::Free(NewValue);
 
-		CachedColumnData->DesiredColumnWidth = static_cast<float>(FontMeasure->Measure(CachedColumnData->DisplayName, CellTextStyle.Font).X + CellPadding);
+	return bChanged;
+}
 
-		OutAvailableColumns.Add(CachedColumnData);
-	}
+void FEasyDataTableEditorUtils::BroadcastPreChange(UDataTable* DataTable, EDataTableChangeInfo Info)
+{
+	FEasyDataTableEditorManager::Get().PreChange(DataTable, Info);
+}
 
-	// Populate the row data
-	OutAvailableRows.Reset(RowMap.Num());
-	int32 Index = 0;
-	for (auto RowIt = RowMap.CreateConstIterator(); RowIt; ++RowIt, ++Index)
+void FEasyDataTableEditorUtils::BroadcastPostChange(UDataTable* DataTable, EDataTableChangeInfo Info)
+{
+	if (DataTable && (EDataTableChangeInfo::RowList == Info))
 	{
-		FText RowName = FText::FromName(RowIt->Key);
-		FEasyDataTableEditorRowListViewDataPtr CachedRowData;
-
-		// If at all possible, attempt to reuse previous rows if their data has not changed.
-		if (Index >= OldRows.Num() || OldRows[Index]->RowId != RowIt->Key || !OldRows[Index]->DisplayName.EqualTo(RowName))
-		{
-			CachedRowData = MakeShareable(new FEasyDataTableEditorRowListViewData());
-			CachedRowData->RowId = RowIt->Key;
-			CachedRowData->DisplayName = RowName;
-			CachedRowData->CellData.Reserve(StructProps.Num());
-		}
-		else
+		for (TObjectIterator<UK2Node_GetDataTableRow> It(RF_Transient | RF_ClassDefaultObject, /** bIncludeDerivedClasses */ true, /** InternalExcludeFlags */ EInternalObjectFlags::Garbage); It; ++It)
 		{
-			CachedRowData = OldRows[Index];
-			CachedRowData->CellData.Reset(StructProps.Num());
+			It->OnDataTableRowListChanged(DataTable);
 		}
+	}
+	FEasyDataTableEditorManager::Get().PostChange(DataTable, Info);
+	DataTable->OnDataTableChanged().Broadcast();
+}
 
-		CachedRowData->DesiredRowHeight = FontMeasure->GetMaxCharacterHeight(CellTextStyle.Font);
-		CachedRowData->RowNum = Index + 1;
+void FEasyDataTableEditorUtils::BroadcastPostRowsChange(UDataTable* DataTable, TConstArrayView<FName> RowNames)
+{
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_BroadcastPostRowsChange, GetNumRowsForStats(DataTable), GetNumColumnsForStats(DataTable));
 
-		// Always rebuild cell data
+	if (!DataTable)
+	{
+		return;
+	}
+
+	// What UDataTable::HandleDataTableChanged does for one row, without its broadcast to the table listeners per row
+	if (DataTable->RowStruct && DataTable->RowStruct->IsChildOf(FTableRowBase::StaticStruct()))
+	{
+		for (const FName RowName : RowNames)
 		{
-			const uint8* RowData = RowIt.Value();
-			for (int32 ColumnIndex = 0; ColumnIndex < StructProps.Num(); ++ColumnIndex)
+			if (uint8* RowData = DataTable->FindRowUnchecked(RowName))
 			{
-				const FProperty* Prop = StructProps[ColumnIndex];
-				FEasyDataTableEditorColumnHeaderDataPtr CachedColumnData = OutAvailableColumns[ColumnIndex];
+				reinterpret_cast<FTableRowBase*>(RowData)->OnDataTableChanged(DataTable, RowName);
+			}
+		}
+	}
+	DataTable->MarkPackageDirty();
 
-				const FText CellText = DataTableUtils::GetPropertyValueAsText(Prop, RowData);
-				CachedRowData->CellData.Add(CellText);
+	BroadcastPostChange(DataTable, EDataTableChangeInfo::RowData);
+}
 
-				const FVector2D CellTextSize = FontMeasure->Measure(CellText, CellTextStyle.Font);
+bool FEasyDataTableEditorUtils::CacheDataTableForEditing(const UDataTable* DataTable, FEasyDataTableEditorRowArena& RowArena, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows, FEasyDataTableEditorCacheTimings* OutTimings, const IEasyDataTableCellMeasurer* CellMeasurer)
+{
+	if (!DataTable || !DataTable->RowStruct)
+	{
+		OutAvailableColumns.Empty();
+		OutAvailableRows.Empty();
+		return false;
+	}
 
-				CachedRowData->DesiredRowHeight = static_cast<float>(FMath::Max(CachedRowData->DesiredRowHeight, CellTextSize.Y));
+	return CacheDataForEditing(DataTable->RowStruct, DataTable->GetRowMap(), RowArena, OutAvailableColumns, OutAvailableRows, OutTimings, GetPersistentCacheName(DataTable), CellMeasurer);
+}
 
-				const float CellWidth = static_cast<float>(CellTextSize.X + CellPadding);
-				CachedColumnData->DesiredColumnWidth = FMath::Max(CachedColumnData->DesiredColumnWidth, CellWidth);
-			}
-		}
+FString FEasyDataTableEditorUtils::GetPersistentCacheName(const UDataTable* DataTable)
+{
+	// Tables that are not saved to a package have nothing to key a persistent cache on
+	const UPackage* Package = DataTable ? DataTable->GetOutermost() : nullptr;
+	return Package && Package != GetTransientPackage() ? Package->GetName() : FString();
+}
 
-		OutAvailableRows.Add(CachedRowData);
-	}
+bool FEasyDataTableEditorUtils::CacheDataForEditing(const UScriptStruct* RowStruct, const TMap<FName, uint8*>& RowMap, FEasyDataTableEditorRowArena& RowArena, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows, FEasyDataTableEditorCacheTimings* OutTimings, const FString& PersistentCacheName, const IEasyDataTableCellMeasurer* CellMeasurer)
+{
+	EASYDATATABLE_SCOPE_CYCLE_COUNTER(STAT_EasyDataTable_CacheDataForEditing, RowMap.Num(), OutAvailableColumns.Num());
+
+	FEasyDataTableCacheBuilder Builder(RowStruct, RowMap, RowArena, OutAvailableColumns, OutAvailableRows, CellMeasurer, PersistentCacheName);
+	Builder.BuildRows(RowMap.Num());
+	Builder.Finish(OutTimings);
+	return Builder.DidReassignRows();
 }
 
 TArray<UScriptStruct*> FEasyDataTableEditorUtils::GetPossibleStructs()
@@ -23,6 +23,39 @@ struct FEasyDataTableEditorColumnHeaderData
 
 	/** The FProperty for the variable in this column */
 	const FProperty* Property;
+
+	/** Distinct cell strings of this column, indexed by cell ID */
+	TArray<FString> CellStrings;
+
+	/** Cell ID of each row, indexed by FEasyDataTableEditorRowListViewData::CellIndex */
+	TArray<uint32> RowCellIds;
+
+	/** Texts of the cell IDs that were displayed so far, created on demand by GetCellText */
+	mutable TArray<FText> CellTexts;
+
+	/** Returns the string of a row's cell in this column */
+	const FString& GetCellString(int32 CellIndex) const
+	{
+		return RowCellIds.IsValidIndex(CellIndex) ? CellStrings[RowCellIds[CellIndex]] : EmptyCellString;
+	}
+
+	/** Returns the text of a row's cell in this column */
+	EASYDATATABLEEDITOR_API FText GetCellText(int32 CellIndex) const;
+
+	/** Points a row's cell at a string, interning it if no other row uses it. Strings no row uses any more are dropped on the next rebuild */
+	EASYDATATABLEEDITOR_API void SetCellString(int32 CellIndex, const FString& CellString);
+
+	/** Drops the cells of every row, keeping the allocations */
+	EASYDATATABLEEDITOR_API void ResetCells(int32 NumRows);
+
+	/** Drops the cells of every row and frees their memory */
+	EASYDATATABLEEDITOR_API void EmptyCells();
+
+	/** Memory used by the cells of this column */
+	EASYDATATABLEEDITOR_API SIZE_T GetCellsAllocatedSize() const;
+
+private:
+	static EASYDATATABLEEDITOR_API const FString EmptyCellString;
 };
 
 struct FEasyDataTableEditorRowListViewData
@@ -39,12 +72,45 @@ struct FEasyDataTableEditorRowListViewData
 	/** Insertion number of the row */
 	uint32 RowNum;
 
-	/** Array corresponding to each cell in this row */
-	TArray<FText> CellData;
+	/** Index of this row's cells in the column cell arrays, see FEasyDataTableEditorColumnHeaderData::GetCellString */
+	int32 CellIndex;
+};
+
+/** Time spent in each stage of CacheDataForEditing */
+struct FEasyDataTableEditorCacheTimings
+{
+	/** Seconds spent converting property values to cell text */
+	double CellTextSeconds = 0.0;
+
+	/** Seconds spent measuring cell text with the cell measurer */
+	double MeasureSeconds = 0.0;
 };
 
 typedef TSharedPtr<FEasyDataTableEditorColumnHeaderData> FEasyDataTableEditorColumnHeaderDataPtr;
-typedef TSharedPtr<FEasyDataTableEditorRowListViewData>  FEasyDataTableEditorRowListViewDataPtr;
+
+/** Rows are owned by an FEasyDataTableEditorRowArena and referenced by address */
+typedef FEasyDataTableEditorRowListViewData* FEasyDataTableEditorRowListViewDataPtr;
+
+/**
+ * Chunked storage of row view models. A slot keeps its address for the lifetime of the arena, so rebuilding
+ * the rows of a table recycles the same memory instead of allocating and refcounting each row again.
+ */
+class EASYDATATABLEEDITOR_API FEasyDataTableEditorRowArena
+{
+public:
+	/** Returns the row stored in a slot, allocating its chunk on first use */
+	FEasyDataTableEditorRowListViewData* GetRow(int32 SlotIndex);
+
+	/** Frees every chunk. Rows handed out before are dangling afterwards */
+	void Empty();
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	static constexpr int32 RowsPerChunk = 1024;
+
+	TArray<TUniquePtr<FEasyDataTableEditorRowListViewData[]>> Chunks;
+};
 
 
 struct FEasyDataTableEditorUtils
@@ -73,6 +139,9 @@ struct FEasyDataTableEditorUtils
 		{
 		public:
 			virtual void SelectionChange(const UDataTable* DataTable, FName RowName) { }
+
+			/** A single cell was written in place by SetCellValue. Listeners that do not track cells treat it as a change of the row data */
+			virtual void CellChange(const UDataTable* DataTable, FName RowName, FName ColumnId) { PostChange(DataTable, EDataTableChangeInfo::RowData); }
 		};
 	};
 
@@ -87,17 +156,90 @@ struct FEasyDataTableEditorUtils
 	static EASYDATATABLEEDITOR_API bool DiffersFromDefault(UDataTable* DataTable, FName RowName);
 	static EASYDATATABLEEDITOR_API bool ResetToDefault(UDataTable* DataTable, FName RowName);
 
+	/** True if cells of the property can be edited in the grid: numbers, bools, enums, names, strings and texts */
+	static EASYDATATABLEEDITOR_API bool CanEditCellInline(const FProperty* Property);
+
+	/** True if importing or comparing values of the property may resolve or load objects, which is only safe on the game thread */
+	static EASYDATATABLEEDITOR_API bool PropertyNeedsGameThread(const FProperty* Property);
+
+	/**
+	 * Writes the value of one cell straight into the row memory, in its own transaction, and notifies listeners
+	 * through CellChange instead of a full row data change.
+	 *
+	 * @param	ColumnId	Name of the row struct property, see FEasyDataTableEditorColumnHeaderData::ColumnId
+	 * @param	Value		Value in the format DataTableUtils imports
+	 * @return	False if the value could not be imported or equals the current value
+	 */
+	static EASYDATATABLEEDITOR_API bool SetCellValue(UDataTable* DataTable, FName RowName, FName ColumnId, const FString& Value);
+
+	/**
+	 * Adds a batch of rows in a single transaction and a single change notification.
+	 * Takes ownership of the row memory, which must be initialized with the table's row struct.
+	 * A row whose name already exists overwrites the existing row.
+	 *
+	 * @param	bRemoveOtherRows	If true, every row that is not part of the batch is removed
+	 * @return	The number of rows added or overwritten
+	 */
+	static EASYDATATABLEEDITOR_API int32 AddOrReplaceRows(UDataTable* DataTable, TArray<TPair<FName, uint8*>>& Rows, bool bRemoveOtherRows);
+
+	/**
+	 * Removes a batch of rows in a single transaction and a single change notification
+	 *
+	 * @return	The number of rows removed
+	 */
+	static EASYDATATABLEEDITOR_API int32 RemoveRows(UDataTable* DataTable, TConstArrayView<FName> RowNames);
+
+	/**
+	 * Renames a batch of rows in a single transaction and a single change notification. As with RenameRow, a renamed
+	 * row moves to the end of the table, and a rename to None or to a name in use is skipped.
+	 *
+	 * @param	Renames		Old and new name of each row, applied in order
+	 * @return	The number of rows renamed
+	 */
+	static EASYDATATABLEEDITOR_API int32 RenameRows(UDataTable* DataTable, TConstArrayView<TPair<FName, FName>> Renames);
+
+	/**
+	 * Writes one column of a batch of rows in a single transaction and a single change notification.
+	 * Unlike SetCellValue, any property that can be imported from text can be written, not only inline editable ones.
+	 *
+	 * @param	ColumnId	Name of the row struct property, see FEasyDataTableEditorColumnHeaderData::ColumnId
+	 * @param	Values		Row name and value of each cell, in the format DataTableUtils imports
+	 * @param	OutProblems	One entry for each value that could not be written
+	 * @return	The number of cells changed
+	 */
+	static EASYDATATABLEEDITOR_API int32 SetColumnValues(UDataTable* DataTable, FName ColumnId, TConstArrayView<TPair<FName, FString>> Values, TArray<FString>& OutProblems);
+
 	static EASYDATATABLEEDITOR_API uint8* AddRowAboveOrBelowSelection(UDataTable* DataTable, const FName& RowName, const FName& NewRowName, ERowInsertionPosition InsertPosition);
 
 	static EASYDATATABLEEDITOR_API void BroadcastPreChange(UDataTable* DataTable, EDataTableChangeInfo Info);
 	static EASYDATATABLEEDITOR_API void BroadcastPostChange(UDataTable* DataTable, EDataTableChangeInfo Info);
-	static EASYDATATABLEEDITOR_API void BroadcastPostRowPropertyChange(UDataTable* DataTable, const FPropertyChangedEvent& PropertyChangedEvent, FProperty* PropertyThatChanged, TSharedPtr<class SEasyRowEditor> EasyRowEditor);
-
-	/** Reads a data table and parses out editable copies of rows and columns */
-	static EASYDATATABLEEDITOR_API void CacheDataTableForEditing(const UDataTable* DataTable, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows);
 
-	/** Generic version that works with any datatable-like structure */
-	static EASYDATATABLEEDITOR_API void CacheDataForEditing(const UScriptStruct* RowStruct, const TMap<FName, uint8*>& RowMap, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows);
+	/**
+	 * Ends a write to the data of several rows, started with one Modify and BroadcastPreChange(RowData).
+	 * Each row struct is told that its row changed, the table listeners are notified once for the whole batch.
+	 */
+	static EASYDATATABLEEDITOR_API void BroadcastPostRowsChange(UDataTable* DataTable, TConstArrayView<FName> RowNames);
+
+	/**
+	 * Reads a data table and parses out editable copies of rows and columns
+	 *
+	 * @param	CellMeasurer	Sizes the columns and rows for the grid, null to cache the data only
+	 * @return	True if a row that was in OutAvailableRows before now holds a different row, see CacheDataForEditing
+	 */
+	static EASYDATATABLEEDITOR_API bool CacheDataTableForEditing(const UDataTable* DataTable, FEasyDataTableEditorRowArena& RowArena, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows, FEasyDataTableEditorCacheTimings* OutTimings = nullptr, const class IEasyDataTableCellMeasurer* CellMeasurer = nullptr);
+
+	/** Name the persistent cell cache of a table is stored under, empty for tables that are not saved to a package */
+	static EASYDATATABLEEDITOR_API FString GetPersistentCacheName(const UDataTable* DataTable);
+
+	/**
+	 * Generic version that works with any datatable-like structure
+	 *
+	 * @param	RowArena				Storage of the rows, the Nth row of the table is always kept in the Nth slot
+	 * @param	PersistentCacheName		If set, the first build reuses the cells stored on disk under this name for rows that did not change, and stores the result
+	 * @param	CellMeasurer			Sizes the columns and rows for the grid. Without one the sizes stay 0 and nothing depends on Slate
+	 * @return	True if a row that was in OutAvailableRows before now holds a different row, so widgets made for it are stale
+	 */
+	static EASYDATATABLEEDITOR_API bool CacheDataForEditing(const UScriptStruct* RowStruct, const TMap<FName, uint8*>& RowMap, FEasyDataTableEditorRowArena& RowArena, TArray<FEasyDataTableEditorColumnHeaderDataPtr>& OutAvailableColumns, TArray<FEasyDataTableEditorRowListViewDataPtr>& OutAvailableRows, FEasyDataTableEditorCacheTimings* OutTimings = nullptr, const FString& PersistentCacheName = FString(), const class IEasyDataTableCellMeasurer* CellMeasurer = nullptr);
 
 	/** Returns all script structs that can be used as a data table row. This only includes loaded ones */
 	static EASYDATATABLEEDITOR_API TArray<UScriptStruct*> GetPossibleStructs();
@@ -0,0 +1,224 @@
+#include "EasyDataTableExporter.h"
+
+#include "Async/ParallelFor.h"
+#include "DataTableUtils.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+namespace EasyDataTableExporter
+{
+	/** Rows converted and written together */
+	static constexpr int32 RowsPerChunk = 1024;
+
+	static void WriteString(FArchive& Archive, const FString& String)
+	{
+		const FTCHARToUTF8 Converted(*String, String.Len());
+		Archive.Serialize(const_cast<ANSICHAR*>(Converted.Get()), Converted.Length());
+	}
+
+	static void AppendCsvValue(FString& Out, const FString& Value)
+	{
+		Out.AppendChar(TEXT('"'));
+		Out.Append(Value.Replace(TEXT("\""), TEXT("\"\"")));
+		Out.AppendChar(TEXT('"'));
+	}
+
+	static void AppendJsonString(FString& Out, const FString& Value)
+	{
+		Out.AppendChar(TEXT('"'));
+		for (const TCHAR Char : Value)
+		{
+			switch (Char)
+			{
+			case TEXT('"'): Out.Append(TEXT("\\\"")); break;
+			case TEXT('\\'): Out.Append(TEXT("\\\\")); break;
+			case TEXT('\n'): Out.Append(TEXT("\\n")); break;
+			case TEXT('\r'): Out.Append(TEXT("\\r")); break;
+			case TEXT('\t'): Out.Append(TEXT("\\t")); break;
+			case TEXT('\b'): Out.Append(TEXT("\\b")); break;
+			case TEXT('\f'): Out.Append(TEXT("\\f")); break;
+			default:
+				if (Char < 0x20)
+				{
+					Out.Appendf(TEXT("\\u%04x"), (uint32)Char);
+				}
+				else
+				{
+					Out.AppendChar(Char);
+				}
+				break;
+			}
+		}
+		Out.AppendChar(TEXT('"'));
+	}
+
+	static void AppendJsonValue(FString& Out, const FProperty* Property, const uint8* RowData)
+	{
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			Out.Append(BoolProperty->GetPropertyValue_InContainer(RowData) ? TEXT("true") : TEXT("false"));
+			return;
+		}
+
+		const FString Value = DataTableUtils::GetPropertyValueAsString(Property, RowData, EDataTableExportFlags::None);
+		const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+		if (NumericProperty && !NumericProperty->IsEnum() && FCString::IsNumeric(*Value))
+		{
+			Out.Append(Value);
+		}
+		else
+		{
+			AppendJsonString(Out, Value);
+		}
+	}
+
+	static FString FormatCsvRow(FName RowName, const uint8* RowData, TConstArrayView<const FProperty*> Properties)
+	{
+		FString Line = RowName.ToString();
+		for (const FProperty* Property : Properties)
+		{
+			Line.AppendChar(TEXT(','));
+			AppendCsvValue(Line, DataTableUtils::GetPropertyValueAsString(Property, RowData, EDataTableExportFlags::None));
+		}
+		Line.AppendChar(TEXT('\n'));
+		return Line;
+	}
+
+	static FString FormatJsonRow(FName RowName, const uint8* RowData, TConstArrayView<const FProperty*> Properties, TConstArrayView<FString> ExportNames)
+	{
+		FString Line = TEXT("\t{\n\t\t\"Name\": ");
+		AppendJsonString(Line, RowName.ToString());
+		for (int32 Index = 0; Index < Properties.Num(); ++Index)
+		{
+			Line.Append(TEXT(",\n\t\t"));
+			AppendJsonString(Line, ExportNames[Index]);
+			Line.Append(TEXT(": "));
+			AppendJsonValue(Line, Properties[Index], RowData);
+		}
+		Line.Append(TEXT("\n\t}"));
+		return Line;
+	}
+}
+
+bool FEasyDataTableExporter::ExportRows(const UDataTable* DataTable, TConstArrayView<FName> RowNames, const FString& Filename, FString& OutError)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FEasyDataTableExporter::ExportRows);
+
+	if (!DataTable || !DataTable->RowStruct)
+	{
+		OutError = TEXT("The Data Table has no row struct");
+		return false;
+	}
+	if (!IsSupportedFile(Filename))
+	{
+		OutError = FString::Printf(TEXT("Unsupported file type '%s', expected .csv or .json"), *Filename);
+		return false;
+	}
+
+	const bool bJson = FPaths::GetExtension(Filename).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+
+	TArray<const FProperty*> Properties;
+	TArray<FString> ExportNames;
+	for (TFieldIterator<const FProperty> It(DataTable->RowStruct); It; ++It)
+	{
+		Properties.Add(*It);
+		ExportNames.Add(DataTableUtils::GetPropertyExportName(*It));
+	}
+
+	// Write next to the destination and move it over at the end, so a failed export never leaves a truncated file
+	const FString TempFilename = Filename + TEXT(".tmp");
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempFilename));
+	if (!Writer)
+	{
+		OutError = FString::Printf(TEXT("Failed to open '%s' for writing"), *TempFilename);
+		return false;
+	}
+
+	if (bJson)
+	{
+		EasyDataTableExporter::WriteString(*Writer, TEXT("["));
+	}
+	else
+	{
+		FString Header = TEXT("---");
+		for (const FString& ExportName : ExportNames)
+		{
+			Header.AppendChar(TEXT(','));
+			Header.Append(ExportName);
+		}
+		Header.AppendChar(TEXT('\n'));
+		EasyDataTableExporter::WriteString(*Writer, Header);
+	}
+
+	const TMap<FName, uint8*>& RowMap = DataTable->GetRowMap();
+	TArray<FString> Lines;
+	bool bFirstJsonRow = true;
+	for (int32 ChunkStart = 0; ChunkStart < RowNames.Num(); ChunkStart += EasyDataTableExporter::RowsPerChunk)
+	{
+		const int32 ChunkSize = FMath::Min(EasyDataTableExporter::RowsPerChunk, RowNames.Num() - ChunkStart);
+		Lines.Reset();
+		Lines.SetNum(ChunkSize);
+
+		ParallelFor(ChunkSize, [&](int32 Index)
+		{
+			const FName RowName = RowNames[ChunkStart + Index];
+			uint8* const* RowData = RowMap.Find(RowName);
+			if (!RowData)
+			{
+				return;
+			}
+
+			Lines[Index] = bJson
+				? EasyDataTableExporter::FormatJsonRow(RowName, *RowData, Properties, ExportNames)
+				: EasyDataTableExporter::FormatCsvRow(RowName, *RowData, Properties);
+		});
+
+		for (const FString& Line : Lines)
+		{
+			if (Line.IsEmpty())
+			{
+				continue;
+			}
+			if (bJson)
+			{
+				EasyDataTableExporter::WriteString(*Writer, bFirstJsonRow ? TEXT("\n") : TEXT(",\n"));
+				bFirstJsonRow = false;
+			}
+			EasyDataTableExporter::WriteString(*Writer, Line);
+		}
+	}
+
+	if (bJson)
+	{
+		EasyDataTableExporter::WriteString(*Writer, TEXT("\n]\n"));
+	}
+
+	const bool bWriteSucceeded = Writer->Close() && !Writer->IsError();
+	Writer.Reset();
+
+	if (!bWriteSucceeded || !IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+	{
+		IFileManager::Get().Delete(*TempFilename);
+		OutError = FString::Printf(TEXT("Failed to write '%s'"), *Filename);
+		return false;
+	}
+	return true;
+}
+
+bool FEasyDataTableExporter::ExportTable(const UDataTable* DataTable, const FString& Filename, FString& OutError)
+{
+	TArray<FName> RowNames;
+	if (DataTable)
+	{
+		DataTable->GetRowMap().GenerateKeyArray(RowNames);
+	}
+	return ExportRows(DataTable, RowNames, Filename, OutError);
+}
+
+bool FEasyDataTableExporter::IsSupportedFile(const FString& Filename)
+{
+	const FString Extension = FPaths::GetExtension(Filename);
+	return Extension.Equals(TEXT("csv"), ESearchCase::IgnoreCase) || Extension.Equals(TEXT("json"), ESearchCase::IgnoreCase);
+}
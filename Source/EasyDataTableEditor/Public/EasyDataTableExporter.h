@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDataTable;
+
+/**
+ * Streams rows of a data table to a CSV or JSON file.
+ * Rows are converted to text in parallel one chunk at a time and written straight to the file, so peak memory
+ * is bounded by the chunk size rather than the table size. The output is deterministic (fixed column order,
+ * every CSV value quoted, one JSON field per line, LF line endings) so that it can be diffed and merged.
+ */
+struct EASYDATATABLEEDITOR_API FEasyDataTableExporter
+{
+	/** Writes the given rows, in order, to the file. The format is picked from the extension */
+	static bool ExportRows(const UDataTable* DataTable, TConstArrayView<FName> RowNames, const FString& Filename, FString& OutError);
+
+	/** Writes every row of the table, in row map order */
+	static bool ExportTable(const UDataTable* DataTable, const FString& Filename, FString& OutError);
+
+	/** Returns true if the file extension is one the exporter can write */
+	static bool IsSupportedFile(const FString& Filename);
+};
@@ -0,0 +1,852 @@
+#include "EasyDataTableImporter.h"
+
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Ticker.h"
+#include "DataTableUtils.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "EasyDataTableEditorUtils.h"
+#include "Engine/DataTable.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/FileManager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+#include "Serialization/JsonReader.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableImporter"
+
+namespace EasyDataTableImporter
+{
+	/** Bytes read from the file per chunk */
+	static constexpr int64 ChunkSize = 1024 * 1024;
+
+	/** Parsed rows converted together; bounds the memory held by unconverted strings */
+	static constexpr int32 BatchSize = 4096;
+
+	/** Stop collecting problems past this, a broken file would otherwise report one per cell */
+	static constexpr int32 MaxProblems = 100;
+
+	/**
+	 * Reads a text file in chunks and decodes it to TCHAR.
+	 * UTF-8 (with or without BOM) and UTF-16LE with BOM are supported, which covers what the engine writes.
+	 * Multi-byte sequences split across a chunk boundary are carried over to the next chunk.
+	 */
+	class FChunkedTextReader
+	{
+	public:
+		FChunkedTextReader(FArchive& InArchive, std::atomic<int64>& InBytesRead)
+			: Archive(InArchive)
+			, BytesRead(InBytesRead)
+		{
+		}
+
+		/** Decodes the next chunk into OutChars, returns false at the end of the file */
+		bool ReadChunk(TArray<TCHAR>& OutChars)
+		{
+			OutChars.Reset();
+
+			const int64 Remaining = Archive.TotalSize() - Archive.Tell();
+			if (Remaining <= 0)
+			{
+				return false;
+			}
+
+			const int64 ToRead = FMath::Min(Remaining, ChunkSize);
+			const int32 Offset = Bytes.Num();
+			Bytes.SetNumUninitialized(Offset + (int32)ToRead, EAllowShrinking::No);
+			Archive.Serialize(Bytes.GetData() + Offset, ToRead);
+			if (Archive.IsError())
+			{
+				return false;
+			}
+			BytesRead += ToRead;
+
+			int32 Start = 0;
+			if (bFirstChunk)
+			{
+				bFirstChunk = false;
+				if (Bytes.Num() >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF)
+				{
+					Start = 3;
+				}
+				else if (Bytes.Num() >= 2 && Bytes[0] == 0xFF && Bytes[1] == 0xFE)
+				{
+					bUtf16 = true;
+					Start = 2;
+				}
+			}
+
+			const bool bLastChunk = Archive.Tell() >= Archive.TotalSize();
+			const int32 End = bLastChunk ? Bytes.Num() : (bUtf16 ? FindCompleteUtf16Length(Start) : FindCompleteUtf8Length(Start));
+
+			if (bUtf16)
+			{
+				const int32 NumCodeUnits = (End - Start) / 2;
+				const auto Converted = StringCast<TCHAR>(reinterpret_cast<const UTF16CHAR*>(Bytes.GetData() + Start), NumCodeUnits);
+				OutChars.Append(Converted.Get(), Converted.Length());
+			}
+			else
+			{
+				const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + Start), End - Start);
+				OutChars.Append(Converted.Get(), Converted.Length());
+			}
+
+			// Keep the incomplete tail for the next chunk
+			Bytes.RemoveAt(0, End, EAllowShrinking::No);
+			return true;
+		}
+
+		/** True once every byte of the file was decoded */
+		bool IsAtEnd() const
+		{
+			return Bytes.Num() == 0 && Archive.Tell() >= Archive.TotalSize();
+		}
+
+	private:
+		int32 FindCompleteUtf8Length(int32 Start) const
+		{
+			const int32 End = Bytes.Num();
+			for (int32 Index = End - 1; Index >= FMath::Max(Start, End - 4); --Index)
+			{
+				const uint8 Byte = Bytes[Index];
+				if ((Byte & 0xC0) == 0x80)
+				{
+					// Continuation byte, keep looking for the lead byte
+					continue;
+				}
+				if (Byte < 0x80)
+				{
+					return End;
+				}
+				const int32 SequenceLength = Byte >= 0xF0 ? 4 : (Byte >= 0xE0 ? 3 : 2);
+				return Index + SequenceLength <= End ? End : Index;
+			}
+			return End;
+		}
+
+		int32 FindCompleteUtf16Length(int32 Start) const
+		{
+			int32 End = Start + ((Bytes.Num() - Start) & ~1);
+			if (End - Start >= 2)
+			{
+				// Do not split a surrogate pair
+				const uint16 LastCodeUnit = uint16(Bytes[End - 2]) | (uint16(Bytes[End - 1]) << 8);
+				if (LastCodeUnit >= 0xD800 && LastCodeUnit <= 0xDBFF)
+				{
+					End -= 2;
+				}
+			}
+			return End;
+		}
+
+		FArchive& Archive;
+		std::atomic<int64>& BytesRead;
+		TArray<uint8> Bytes;
+		bool bFirstChunk = true;
+		bool bUtf16 = false;
+	};
+
+	/** Incremental RFC 4180 tokenizer, fed one decoded chunk at a time */
+	class FCsvTokenizer
+	{
+	public:
+		/** Consumes a chunk and appends every completed record to OutRecords */
+		void Feed(const TCHAR* Chars, int32 NumChars, TArray<TArray<FString>>& OutRecords)
+		{
+			for (int32 Index = 0; Index < NumChars; ++Index)
+			{
+				const TCHAR Char = Chars[Index];
+
+				if (bSkipLineFeed)
+				{
+					bSkipLineFeed = false;
+					if (Char == TEXT('\n'))
+					{
+						continue;
+					}
+				}
+
+				if (bInQuotes)
+				{
+					if (bPendingQuote)
+					{
+						bPendingQuote = false;
+						if (Char == TEXT('"'))
+						{
+							// Escaped quote
+							CurrentField.AppendChar(Char);
+							continue;
+						}
+						bInQuotes = false;
+					}
+					else
+					{
+						if (Char == TEXT('"'))
+						{
+							bPendingQuote = true;
+						}
+						else
+						{
+							CurrentField.AppendChar(Char);
+						}
+						continue;
+					}
+				}
+
+				if (Char == TEXT('"') && !bFieldQuoted && CurrentField.IsEmpty())
+				{
+					bInQuotes = true;
+					bFieldQuoted = true;
+				}
+				else if (Char == TEXT(','))
+				{
+					EndField();
+				}
+				else if (Char == TEXT('\r') || Char == TEXT('\n'))
+				{
+					bSkipLineFeed = Char == TEXT('\r');
+					EndRecord(OutRecords);
+				}
+				else
+				{
+					CurrentField.AppendChar(Char);
+				}
+			}
+		}
+
+		/** Flushes the last record if the file does not end with a line break */
+		void Finish(TArray<TArray<FString>>& OutRecords)
+		{
+			bInQuotes = false;
+			bPendingQuote = false;
+			if (!CurrentField.IsEmpty() || CurrentRecord.Num() > 0)
+			{
+				EndRecord(OutRecords);
+			}
+		}
+
+	private:
+		void EndField()
+		{
+			CurrentRecord.Add(MoveTemp(CurrentField));
+			CurrentField.Reset();
+			bFieldQuoted = false;
+		}
+
+		void EndRecord(TArray<TArray<FString>>& OutRecords)
+		{
+			EndField();
+
+			// Blank lines produce a single empty field
+			if (CurrentRecord.Num() > 1 || !CurrentRecord[0].IsEmpty())
+			{
+				OutRecords.Add(MoveTemp(CurrentRecord));
+			}
+			CurrentRecord.Reset();
+		}
+
+		TArray<FString> CurrentRecord;
+		FString CurrentField;
+		bool bInQuotes = false;
+		bool bPendingQuote = false;
+		bool bFieldQuoted = false;
+		bool bSkipLineFeed = false;
+	};
+
+	/** Archive adapter that serves decoded TCHARs to TJsonReader, pulling chunks on demand */
+	class FDecodedTextArchive : public FArchive
+	{
+	public:
+		FDecodedTextArchive(FChunkedTextReader& InReader, const std::atomic<bool>& bInCancelRequested)
+			: Reader(InReader)
+			, bCancelRequested(bInCancelRequested)
+		{
+			SetIsLoading(true);
+		}
+
+		virtual void Serialize(void* Data, int64 Num) override
+		{
+			uint8* Dest = static_cast<uint8*>(Data);
+			while (Num > 0)
+			{
+				if (Position >= Chars.Num())
+				{
+					Position = 0;
+					if (bCancelRequested || !Reader.ReadChunk(Chars))
+					{
+						SetError();
+						FMemory::Memzero(Dest, Num);
+						return;
+					}
+					continue;
+				}
+
+				const int64 NumBytes = FMath::Min<int64>(Num, (Chars.Num() - Position) * sizeof(TCHAR));
+				FMemory::Memcpy(Dest, reinterpret_cast<const uint8*>(Chars.GetData() + Position), NumBytes);
+				Position += (int32)(NumBytes / sizeof(TCHAR));
+				Dest += NumBytes;
+				Num -= NumBytes;
+			}
+		}
+
+		virtual bool AtEnd() override
+		{
+			return Position >= Chars.Num() && Reader.IsAtEnd();
+		}
+
+		virtual FString GetArchiveName() const override { return TEXT("EasyDataTableImporter"); }
+
+	private:
+		FChunkedTextReader& Reader;
+		const std::atomic<bool>& bCancelRequested;
+		TArray<TCHAR> Chars;
+		int32 Position = 0;
+	};
+
+	static TSharedPtr<FJsonValue> ReadJsonValue(TJsonReader<TCHAR>& Reader, EJsonNotation Notation);
+
+	static TSharedPtr<FJsonObject> ReadJsonObject(TJsonReader<TCHAR>& Reader)
+	{
+		TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				return Object;
+			}
+
+			const FString Identifier = Reader.GetIdentifier();
+			TSharedPtr<FJsonValue> Value = ReadJsonValue(Reader, Notation);
+			if (!Value.IsValid())
+			{
+				return nullptr;
+			}
+			Object->SetField(Identifier, Value);
+		}
+		return nullptr;
+	}
+
+	static TSharedPtr<FJsonValue> ReadJsonValue(TJsonReader<TCHAR>& Reader, EJsonNotation Notation)
+	{
+		switch (Notation)
+		{
+		case EJsonNotation::String:
+			return MakeShared<FJsonValueString>(Reader.GetValueAsString());
+		case EJsonNotation::Number:
+			// Keep the source text so large integers survive the round trip
+			return MakeShared<FJsonValueNumberString>(Reader.GetValueAsNumberString());
+		case EJsonNotation::Boolean:
+			return MakeShared<FJsonValueBoolean>(Reader.GetValueAsBoolean());
+		case EJsonNotation::Null:
+			return MakeShared<FJsonValueNull>();
+		case EJsonNotation::ObjectStart:
+		{
+			TSharedPtr<FJsonObject> Object = ReadJsonObject(Reader);
+			return Object.IsValid() ? MakeShared<FJsonValueObject>(Object) : nullptr;
+		}
+		case EJsonNotation::ArrayStart:
+		{
+			TArray<TSharedPtr<FJsonValue>> Values;
+			EJsonNotation ElementNotation;
+			while (Reader.ReadNext(ElementNotation))
+			{
+				if (ElementNotation == EJsonNotation::ArrayEnd)
+				{
+					return MakeShared<FJsonValueArray>(Values);
+				}
+				TSharedPtr<FJsonValue> Value = ReadJsonValue(Reader, ElementNotation);
+				if (!Value.IsValid())
+				{
+					return nullptr;
+				}
+				Values.Add(Value);
+			}
+			return nullptr;
+		}
+		default:
+			return nullptr;
+		}
+	}
+}
+
+TSharedPtr<FEasyDataTableImporter> FEasyDataTableImporter::StartImport(UDataTable* DataTable, const FString& Filename, EImportMode Mode)
+{
+	if (!DataTable || !DataTable->RowStruct || !IsSupportedFile(Filename) || !IFileManager::Get().FileExists(*Filename))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FEasyDataTableImporter> Importer = MakeShareable(new FEasyDataTableImporter(DataTable, Filename, Mode));
+	Importer->SelfReference = Importer;
+	Importer->bRunning = true;
+
+	FNotificationInfo Info(FText::GetEmpty());
+	Info.Text = TAttribute<FText>::CreateSP(Importer.ToSharedRef(), &FEasyDataTableImporter::GetProgressText);
+	Info.bFireAndForget = false;
+	Info.bUseThrobber = true;
+	Info.ButtonDetails.Add(FNotificationButtonInfo(
+		LOCTEXT("CancelImport", "Cancel"),
+		LOCTEXT("CancelImportToolTip", "Stop the import. The Data Table is left unchanged"),
+		FSimpleDelegate::CreateSP(Importer.ToSharedRef(), &FEasyDataTableImporter::Cancel),
+		SNotificationItem::CS_Pending));
+	Importer->Notification = FSlateNotificationManager::Get().AddNotification(Info);
+	if (Importer->Notification.IsValid())
+	{
+		Importer->Notification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	Async(EAsyncExecution::ThreadPool, [Importer]()
+	{
+		Importer->Run();
+	});
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(Importer.ToSharedRef(), &FEasyDataTableImporter::TickProgress), 0.1f);
+	return Importer;
+}
+
+bool FEasyDataTableImporter::ImportFile(UDataTable* DataTable, const FString& Filename, EImportMode Mode, TArray<FString>& OutProblems)
+{
+	check(IsInGameThread());
+
+	if (!DataTable || !DataTable->RowStruct)
+	{
+		OutProblems.Add(TEXT("The Data Table has no row struct"));
+		return false;
+	}
+	if (!IsSupportedFile(Filename))
+	{
+		OutProblems.Add(FString::Printf(TEXT("Unsupported file type '%s', expected .csv or .json"), *Filename));
+		return false;
+	}
+
+	TSharedPtr<FEasyDataTableImporter> Importer = MakeShareable(new FEasyDataTableImporter(DataTable, Filename, Mode));
+	Importer->Run();
+	const bool bSuccess = Importer->Commit();
+	OutProblems.Append(Importer->Problems);
+	return bSuccess;
+}
+
+bool FEasyDataTableImporter::IsSupportedFile(const FString& Filename)
+{
+	const FString Extension = FPaths::GetExtension(Filename);
+	return Extension.Equals(TEXT("csv"), ESearchCase::IgnoreCase) || Extension.Equals(TEXT("json"), ESearchCase::IgnoreCase);
+}
+
+FEasyDataTableImporter::FEasyDataTableImporter(UDataTable* InDataTable, const FString& InFilename, EImportMode InMode)
+	: DataTable(InDataTable)
+	, RowStruct(InDataTable->RowStruct)
+	, Filename(InFilename)
+	, Mode(InMode)
+	, BytesRead(0)
+	, TotalBytes(0)
+	, bCancelRequested(false)
+	, bParsingComplete(false)
+	, bParsingSucceeded(false)
+	, bRunning(false)
+{
+	// Resolve every name a column may be imported as up front so the workers only read the map
+	int32 PropertyIndex = 0;
+	for (TFieldIterator<const FProperty> It(InDataTable->RowStruct); It; ++It, ++PropertyIndex)
+	{
+		TArray<FString> ImportNames;
+		DataTableUtils::GetPropertyImportNames(*It, ImportNames);
+		for (const FString& ImportName : ImportNames)
+		{
+			ColumnIndexByImportName.Add(ImportName, PropertyIndex);
+		}
+		ColumnProperties.Add(*It);
+		GameThreadColumns.Add(FEasyDataTableEditorUtils::PropertyNeedsGameThread(*It));
+	}
+}
+
+FEasyDataTableImporter::~FEasyDataTableImporter()
+{
+	ReleaseImportedRows();
+}
+
+void FEasyDataTableImporter::Cancel()
+{
+	bCancelRequested = true;
+}
+
+bool FEasyDataTableImporter::IsRunning() const
+{
+	return bRunning;
+}
+
+float FEasyDataTableImporter::GetProgress() const
+{
+	return TotalBytes > 0 ? FMath::Clamp((float)((double)BytesRead / (double)TotalBytes), 0.0f, 1.0f) : 0.0f;
+}
+
+void FEasyDataTableImporter::Run()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FEasyDataTableImporter::Run);
+
+	if (FPaths::GetExtension(Filename).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+	{
+		ParseJson();
+	}
+	else
+	{
+		ParseCsv();
+	}
+
+	bParsingComplete = true;
+}
+
+void FEasyDataTableImporter::ParseCsv()
+{
+	TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Archive)
+	{
+		AddProblem(FString::Printf(TEXT("Failed to open '%s'"), *Filename));
+		return;
+	}
+	TotalBytes = Archive->TotalSize();
+
+	EasyDataTableImporter::FChunkedTextReader Reader(*Archive, BytesRead);
+	EasyDataTableImporter::FCsvTokenizer Tokenizer;
+
+	// Maps each column of the file to a column of the row struct
+	TArray<int32> FileColumnToColumn;
+	bool bHasHeader = false;
+
+	TArray<TCHAR> Chars;
+	TArray<TArray<FString>> Records;
+	TArray<FParsedRow> Batch;
+
+	auto ProcessRecords = [&]()
+	{
+		for (TArray<FString>& Record : Records)
+		{
+			if (!bHasHeader)
+			{
+				bHasHeader = true;
+				for (int32 FileColumn = 1; FileColumn < Record.Num(); ++FileColumn)
+				{
+					const int32* ColumnIndex = ColumnIndexByImportName.Find(Record[FileColumn]);
+					FileColumnToColumn.Add(ColumnIndex ? *ColumnIndex : INDEX_NONE);
+					if (!ColumnIndex)
+					{
+						AddProblem(FString::Printf(TEXT("Column '%s' does not match any property of the row struct"), *Record[FileColumn]));
+					}
+				}
+				continue;
+			}
+
+			FParsedRow& Row = Batch.AddDefaulted_GetRef();
+			Row.Name = DataTableUtils::MakeValidName(Record[0]);
+			Row.Cells.Reserve(FileColumnToColumn.Num());
+			for (int32 FileColumn = 1; FileColumn < Record.Num() && FileColumn - 1 < FileColumnToColumn.Num(); ++FileColumn)
+			{
+				if (FileColumnToColumn[FileColumn - 1] != INDEX_NONE)
+				{
+					FDeferredCell& Cell = Row.Cells.AddDefaulted_GetRef();
+					Cell.ColumnIndex = FileColumnToColumn[FileColumn - 1];
+					Cell.Text = MoveTemp(Record[FileColumn]);
+				}
+			}
+
+			if (Batch.Num() >= EasyDataTableImporter::BatchSize)
+			{
+				ConvertBatch(Batch);
+			}
+		}
+		Records.Reset();
+	};
+
+	while (!bCancelRequested && Reader.ReadChunk(Chars))
+	{
+		Tokenizer.Feed(Chars.GetData(), Chars.Num(), Records);
+		ProcessRecords();
+	}
+
+	if (bCancelRequested || Archive->IsError())
+	{
+		return;
+	}
+
+	Tokenizer.Finish(Records);
+	ProcessRecords();
+	ConvertBatch(Batch);
+
+	bParsingSucceeded = !bCancelRequested;
+}
+
+void FEasyDataTableImporter::ParseJson()
+{
+	TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Archive)
+	{
+		AddProblem(FString::Printf(TEXT("Failed to open '%s'"), *Filename));
+		return;
+	}
+	TotalBytes = Archive->TotalSize();
+
+	EasyDataTableImporter::FChunkedTextReader Reader(*Archive, BytesRead);
+	EasyDataTableImporter::FDecodedTextArchive TextArchive(Reader, bCancelRequested);
+	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(&TextArchive);
+
+	EJsonNotation Notation;
+	if (!JsonReader->ReadNext(Notation) || Notation != EJsonNotation::ArrayStart)
+	{
+		AddProblem(TEXT("Expected the file to contain an array of rows"));
+		return;
+	}
+
+	TArray<FParsedRow> Batch;
+	while (!bCancelRequested && JsonReader->ReadNext(Notation))
+	{
+		if (Notation == EJsonNotation::ArrayEnd)
+		{
+			ConvertBatch(Batch);
+			bParsingSucceeded = !bCancelRequested;
+			return;
+		}
+
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			AddProblem(TEXT("Expected a row object"));
+			return;
+		}
+
+		TSharedPtr<FJsonObject> RowObject = EasyDataTableImporter::ReadJsonObject(*JsonReader);
+		if (!RowObject.IsValid())
+		{
+			break;
+		}
+
+		FString RowName;
+		if (!RowObject->TryGetStringField(TEXT("Name"), RowName))
+		{
+			AddProblem(TEXT("Row has no 'Name' field"));
+			continue;
+		}
+
+		FParsedRow& Row = Batch.AddDefaulted_GetRef();
+		Row.Name = DataTableUtils::MakeValidName(RowName);
+		Row.Cells.Reserve(RowObject->Values.Num());
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : RowObject->Values)
+		{
+			if (const int32* ColumnIndex = ColumnIndexByImportName.Find(Field.Key))
+			{
+				FDeferredCell& Cell = Row.Cells.AddDefaulted_GetRef();
+				Cell.ColumnIndex = *ColumnIndex;
+				Cell.JsonValue = Field.Value;
+			}
+		}
+
+		if (Batch.Num() >= EasyDataTableImporter::BatchSize)
+		{
+			ConvertBatch(Batch);
+		}
+	}
+
+	if (!bCancelRequested)
+	{
+		AddProblem(FString::Printf(TEXT("Invalid JSON: %s"), *JsonReader->GetErrorMessage()));
+	}
+}
+
+void FEasyDataTableImporter::ConvertBatch(TArray<FParsedRow>& Batch)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FEasyDataTableImporter::ConvertBatch);
+
+	const UScriptStruct* Struct = RowStruct.GetEvenIfUnreachable();
+	if (Batch.Num() == 0 || !Struct || bCancelRequested)
+	{
+		Batch.Reset();
+		return;
+	}
+
+	const int32 FirstRow = ImportedRows.Num();
+	ImportedRows.AddDefaulted(Batch.Num());
+
+	ParallelFor(Batch.Num(), [this, &Batch, Struct, FirstRow](int32 Index)
+	{
+		if (bCancelRequested)
+		{
+			return;
+		}
+
+		FParsedRow& ParsedRow = Batch[Index];
+		FImportedRow& Row = ImportedRows[FirstRow + Index];
+		Row.Name = ParsedRow.Name;
+		if (Row.Name == NAME_None)
+		{
+			AddProblem(TEXT("Row with an empty name skipped"));
+			return;
+		}
+
+		Row.Data = static_cast<uint8*>(FMemory::Malloc(Struct->GetStructureSize()));
+		Struct->InitializeStruct(Row.Data);
+
+		for (FDeferredCell& Cell : ParsedRow.Cells)
+		{
+			if (GameThreadColumns[Cell.ColumnIndex])
+			{
+				Row.DeferredCells.Add(MoveTemp(Cell));
+				continue;
+			}
+
+			const FString Error = ConvertCell(Cell, Row.Data);
+			if (!Error.IsEmpty())
+			{
+				AddProblem(FString::Printf(TEXT("Row '%s', column '%s': %s"), *Row.Name.ToString(), *ColumnProperties[Cell.ColumnIndex]->GetName(), *Error));
+			}
+		}
+	});
+
+	// Parsed strings are no longer needed once converted
+	Batch.Reset();
+}
+
+FString FEasyDataTableImporter::ConvertCell(const FDeferredCell& Cell, uint8* RowData) const
+{
+	const FProperty* Property = ColumnProperties[Cell.ColumnIndex];
+	if (!Cell.JsonValue.IsValid())
+	{
+		return DataTableUtils::AssignStringToProperty(Cell.Text, Property, RowData);
+	}
+
+	switch (Cell.JsonValue->Type)
+	{
+	case EJson::Null:
+		return FString();
+	case EJson::Boolean:
+		return DataTableUtils::AssignStringToProperty(Cell.JsonValue->AsBool() ? TEXT("True") : TEXT("False"), Property, RowData);
+	case EJson::String:
+	case EJson::Number:
+		return DataTableUtils::AssignStringToProperty(Cell.JsonValue->AsString(), Property, RowData);
+	default:
+		return FJsonObjectConverter::JsonValueToUProperty(Cell.JsonValue, Property, Property->ContainerPtrToValuePtr<void>(RowData), 0, 0)
+			? FString()
+			: FString(TEXT("Failed to convert the JSON value"));
+	}
+}
+
+bool FEasyDataTableImporter::Commit()
+{
+	check(IsInGameThread());
+
+	UDataTable* Table = DataTable.Get();
+	if (!bParsingSucceeded || bCancelRequested || !Table || Table->RowStruct != RowStruct.Get())
+	{
+		ReleaseImportedRows();
+		return false;
+	}
+
+	TArray<TPair<FName, uint8*>> Rows;
+	Rows.Reserve(ImportedRows.Num());
+	for (FImportedRow& Row : ImportedRows)
+	{
+		if (!Row.Data)
+		{
+			continue;
+		}
+
+		for (const FDeferredCell& Cell : Row.DeferredCells)
+		{
+			const FString Error = ConvertCell(Cell, Row.Data);
+			if (!Error.IsEmpty())
+			{
+				AddProblem(FString::Printf(TEXT("Row '%s', column '%s': %s"), *Row.Name.ToString(), *ColumnProperties[Cell.ColumnIndex]->GetName(), *Error));
+			}
+		}
+		Rows.Emplace(Row.Name, Row.Data);
+		Row.Data = nullptr;
+	}
+	ImportedRows.Empty();
+
+	FEasyDataTableEditorUtils::AddOrReplaceRows(Table, Rows, Mode == EImportMode::Replace);
+	return true;
+}
+
+void FEasyDataTableImporter::ReleaseImportedRows()
+{
+	const UScriptStruct* Struct = RowStruct.GetEvenIfUnreachable();
+	for (FImportedRow& Row : ImportedRows)
+	{
+		if (Row.Data)
+		{
+			if (Struct)
+			{
+				Struct->DestroyStruct(Row.Data);
+			}
+			FMemory::Free(Row.Data);
+			Row.Data = nullptr;
+		}
+	}
+	ImportedRows.Empty();
+}
+
+void FEasyDataTableImporter::AddProblem(const FString& Problem)
+{
+	FScopeLock Lock(&ProblemsCriticalSection);
+	if (Problems.Num() < EasyDataTableImporter::MaxProblems)
+	{
+		Problems.Add(Problem);
+	}
+}
+
+bool FEasyDataTableImporter::TickProgress(float DeltaTime)
+{
+	if (!bParsingComplete)
+	{
+		return true;
+	}
+
+	const bool bCancelled = bCancelRequested;
+	const bool bSuccess = Commit();
+	bRunning = false;
+
+	for (const FString& Problem : Problems)
+	{
+		UE_LOG(LogDataTable, Warning, TEXT("%s: %s"), *Filename, *Problem);
+	}
+
+	if (Notification.IsValid())
+	{
+		if (bCancelled)
+		{
+			Notification->SetText(LOCTEXT("ImportCancelled", "Import cancelled"));
+		}
+		else if (!bSuccess)
+		{
+			Notification->SetText(LOCTEXT("ImportFailed", "Import failed, see the Output Log"));
+		}
+		else if (Problems.Num() > 0)
+		{
+			Notification->SetText(FText::Format(LOCTEXT("ImportWithProblems", "Imported {0} with problems, see the Output Log"), FText::FromString(FPaths::GetCleanFilename(Filename))));
+		}
+		else
+		{
+			Notification->SetText(FText::Format(LOCTEXT("ImportSucceeded", "Imported {0}"), FText::FromString(FPaths::GetCleanFilename(Filename))));
+		}
+		Notification->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		Notification->ExpireAndFadeout();
+		Notification.Reset();
+	}
+
+	// Last reference may be released here, do not touch members afterwards
+	SelfReference.Reset();
+	return false;
+}
+
+FText FEasyDataTableImporter::GetProgressText() const
+{
+	if (bParsingComplete)
+	{
+		return LOCTEXT("ImportCommitting", "Committing imported rows...");
+	}
+	return FText::Format(LOCTEXT("ImportProgress", "Importing {0}... {1}"),
+		FText::FromString(FPaths::GetCleanFilename(Filename)),
+		FText::AsPercent(GetProgress()));
+}
+
+#undef LOCTEXT_NAMESPACE
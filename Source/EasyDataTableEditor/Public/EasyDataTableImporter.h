@@ -0,0 +1,131 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#include <atomic>
+
+class FJsonValue;
+class SNotificationItem;
+class UDataTable;
+class UScriptStruct;
+
+/**
+ * Streams a CSV or JSON file into a data table.
+ * The file is read and decoded in chunks and parsed on a worker thread. Each chunk of parsed rows is converted
+ * to row memory in parallel. Nothing touches the table until the whole file is parsed; the rows are then committed
+ * to the row map in one batch on the game thread.
+ */
+class EASYDATATABLEEDITOR_API FEasyDataTableImporter : public TSharedFromThis<FEasyDataTableImporter>
+{
+public:
+	enum class EImportMode
+	{
+		/** Rows that are not in the file are removed, like a reimport */
+		Replace,
+		/** Rows in the file are added or overwrite the row with the same name, other rows are kept */
+		Merge,
+	};
+
+	/**
+	 * Starts a background import of the file into the table, with a progress notification and a cancel button
+	 *
+	 * @return	The running import, or null if the file could not be opened
+	 */
+	static TSharedPtr<FEasyDataTableImporter> StartImport(UDataTable* DataTable, const FString& Filename, EImportMode Mode);
+
+	/** Imports the file on the calling thread, for use where there is no UI */
+	static bool ImportFile(UDataTable* DataTable, const FString& Filename, EImportMode Mode, TArray<FString>& OutProblems);
+
+	/** Returns true if the file extension is one the importer can read */
+	static bool IsSupportedFile(const FString& Filename);
+
+	~FEasyDataTableImporter();
+
+	/** Requests the import to stop. Nothing is committed to the table */
+	void Cancel();
+
+	bool IsRunning() const;
+
+	/** Progress of the parsing stage in [0, 1] */
+	float GetProgress() const;
+
+private:
+	/** A cell whose value can only be converted on the game thread, e.g. because it references objects */
+	struct FDeferredCell
+	{
+		int32 ColumnIndex = INDEX_NONE;
+		FString Text;
+		TSharedPtr<FJsonValue> JsonValue;
+	};
+
+	struct FImportedRow
+	{
+		FName Name;
+		uint8* Data = nullptr;
+		TArray<FDeferredCell> DeferredCells;
+	};
+
+	/** A parsed but not yet converted row */
+	struct FParsedRow
+	{
+		FName Name;
+		TArray<FDeferredCell> Cells;
+	};
+
+	FEasyDataTableImporter(UDataTable* InDataTable, const FString& InFilename, EImportMode InMode);
+
+	/** Worker entry point, parses and converts the whole file */
+	void Run();
+	void ParseCsv();
+	void ParseJson();
+
+	/** Converts a batch of parsed rows to row memory in parallel and appends them to ImportedRows */
+	void ConvertBatch(TArray<FParsedRow>& Batch);
+
+	/** Converts a single cell, returns an error message on failure */
+	FString ConvertCell(const FDeferredCell& Cell, uint8* RowData) const;
+
+	/** Resolves the deferred cells and hands the rows over to the table. Game thread only */
+	bool Commit();
+
+	/** Frees every row that was not handed over to the table */
+	void ReleaseImportedRows();
+
+	void AddProblem(const FString& Problem);
+
+	bool TickProgress(float DeltaTime);
+	FText GetProgressText() const;
+
+	TWeakObjectPtr<UDataTable> DataTable;
+	TWeakObjectPtr<const UScriptStruct> RowStruct;
+	FString Filename;
+	EImportMode Mode;
+
+	/** Properties of the row struct, indexed by column */
+	TArray<const FProperty*> ColumnProperties;
+
+	/** Columns whose property must be imported on the game thread */
+	TBitArray<> GameThreadColumns;
+
+	/** Column lookup by any of the names its property can be imported as */
+	TMap<FString, int32> ColumnIndexByImportName;
+
+	TArray<FImportedRow> ImportedRows;
+
+	FCriticalSection ProblemsCriticalSection;
+	TArray<FString> Problems;
+
+	std::atomic<int64> BytesRead;
+	std::atomic<int64> TotalBytes;
+	std::atomic<bool> bCancelRequested;
+	std::atomic<bool> bParsingComplete;
+	bool bParsingSucceeded;
+	bool bRunning;
+
+	TSharedPtr<SNotificationItem> Notification;
+
+	/** Keeps the import alive while it runs in the background, independently of the editor that started it */
+	TSharedPtr<FEasyDataTableImporter> SelfReference;
+};
@@ -0,0 +1,163 @@
+#include "EasyDataTableLayoutStore.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace EasyDataTableLayoutStore
+{
+	/** Changes made within this delay are written together */
+	static constexpr float FlushDelaySeconds = 2.0f;
+
+	/** True if no other table in the project has the name a legacy layout is stored under */
+	static bool IsLegacyNameUnique(const FString& LegacyName)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+		if (AssetRegistry.IsLoadingAssets())
+		{
+			// The tables that share the name may not be known yet
+			return false;
+		}
+
+		TArray<FAssetData> TableAssets;
+		AssetRegistry.GetAssetsByClass(UDataTable::StaticClass()->GetClassPathName(), TableAssets, /*bSearchSubClasses*/ true);
+
+		int32 NumMatches = 0;
+		for (const FAssetData& TableAsset : TableAssets)
+		{
+			if (TableAsset.AssetName.ToString() == LegacyName && ++NumMatches > 1)
+			{
+				return false;
+			}
+		}
+		return NumMatches == 1;
+	}
+}
+
+FEasyDataTableLayoutStore& FEasyDataTableLayoutStore::Get()
+{
+	static FEasyDataTableLayoutStore Instance;
+	return Instance;
+}
+
+void FEasyDataTableLayoutStore::Initialize()
+{
+	FString JsonText;
+	if (FFileHelper::LoadFileToString(JsonText, *GetLayoutFilename()))
+	{
+		TSharedPtr<FJsonObject> LoadedLayouts;
+		TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonText);
+		if (FJsonSerializer::Deserialize(JsonReader, LoadedLayouts) && LoadedLayouts.IsValid())
+		{
+			Layouts = LoadedLayouts.ToSharedRef();
+		}
+	}
+}
+
+void FEasyDataTableLayoutStore::Shutdown()
+{
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+		Flush();
+	}
+
+	if (PendingWrite.IsValid())
+	{
+		PendingWrite.Wait();
+	}
+}
+
+TSharedRef<FJsonObject> FEasyDataTableLayoutStore::FindOrAddLayout(const FString& PackagePath, const FString& LegacyName)
+{
+	const TSharedPtr<FJsonObject>* ExistingLayout = nullptr;
+	if (Layouts->TryGetObjectField(PackagePath, ExistingLayout))
+	{
+		return ExistingLayout->ToSharedRef();
+	}
+
+	TSharedPtr<FJsonObject> Layout;
+
+	// Layouts used to be stored per table name. Tables in different folders that share a name shared that layout,
+	// so it is only migrated when the name is unambiguous, and the file is dropped so it is migrated once
+	const FString LegacyFilename = FPaths::ProjectSavedDir() / TEXT("AssetData") / TEXT("DataTableEditorLayout") / LegacyName + TEXT(".json");
+	FString JsonText;
+	if (!LegacyName.IsEmpty() && IFileManager::Get().FileExists(*LegacyFilename)
+		&& EasyDataTableLayoutStore::IsLegacyNameUnique(LegacyName)
+		&& FFileHelper::LoadFileToString(JsonText, *LegacyFilename))
+	{
+		TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonText);
+		if (FJsonSerializer::Deserialize(JsonReader, Layout) && Layout.IsValid())
+		{
+			IFileManager::Get().Delete(*LegacyFilename);
+		}
+	}
+
+	if (!Layout.IsValid())
+	{
+		Layout = MakeShared<FJsonObject>();
+	}
+
+	Layouts->SetObjectField(PackagePath, Layout);
+	MarkDirty();
+	return Layout.ToSharedRef();
+}
+
+void FEasyDataTableLayoutStore::MarkDirty()
+{
+	// Restart the delay, the file is written once the changes stop
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+	}
+	FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FEasyDataTableLayoutStore::HandleFlushTicker),
+		EasyDataTableLayoutStore::FlushDelaySeconds);
+}
+
+bool FEasyDataTableLayoutStore::HandleFlushTicker(float DeltaTime)
+{
+	FlushTickerHandle.Reset();
+	Flush();
+	return false;
+}
+
+void FEasyDataTableLayoutStore::Flush()
+{
+	// The JSON objects are edited on the game thread, so only the serialized text goes to the worker
+	FString JsonText;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonText);
+	if (!FJsonSerializer::Serialize(Layouts, JsonWriter))
+	{
+		return;
+	}
+
+	// Chain on the previous write so an older layout can never land after a newer one
+	TFuture<void> PreviousWrite = MoveTemp(PendingWrite);
+	PendingWrite = Async(EAsyncExecution::ThreadPool, [JsonText = MoveTemp(JsonText), PreviousWrite = MoveTemp(PreviousWrite)]() mutable
+	{
+		if (PreviousWrite.IsValid())
+		{
+			PreviousWrite.Wait();
+		}
+
+		const FString Filename = GetLayoutFilename();
+		const FString TempFilename = Filename + TEXT(".tmp");
+		if (FFileHelper::SaveStringToFile(JsonText, *TempFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			IFileManager::Get().Move(*Filename, *TempFilename, true, true);
+		}
+	});
+}
+
+FString FEasyDataTableLayoutStore::GetLayoutFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("AssetData") / TEXT("EasyDataTableEditorLayout.json");
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Editor layout of every table (column widths, sort, filter, hidden columns, column order), keyed by package path.
+ * All layouts live in a single file that is read once at module startup. Changes are coalesced and the file
+ * is rewritten on a background thread a short while after the last change.
+ */
+class EASYDATATABLEEDITOR_API FEasyDataTableLayoutStore
+{
+public:
+	static FEasyDataTableLayoutStore& Get();
+
+	/** Reads the layout file, called at module startup */
+	void Initialize();
+
+	/** Writes pending changes and waits for them, called at module shutdown */
+	void Shutdown();
+
+	/**
+	 * Returns the layout of a table, creating an empty one if there is none.
+	 * The object is owned by the store; call MarkDirty after changing it.
+	 *
+	 * @param	LegacyName	Name the table's layout was stored under by older versions, migrated on first use if no other table has that name
+	 */
+	TSharedRef<FJsonObject> FindOrAddLayout(const FString& PackagePath, const FString& LegacyName);
+
+	/** Schedules a write of the layout file */
+	void MarkDirty();
+
+private:
+	bool HandleFlushTicker(float DeltaTime);
+
+	/** Serializes the layouts and writes them in the background */
+	void Flush();
+
+	static FString GetLayoutFilename();
+
+	TSharedRef<FJsonObject> Layouts = MakeShared<FJsonObject>();
+
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+
+	/** Write issued by the last flush, waited on at shutdown */
+	TFuture<void> PendingWrite;
+};
@@ -0,0 +1,168 @@
+#include "EasyDataTableNumericColumn.h"
+
+#include "EasyDataTableEditorStats.h"
+#include "Math/VectorRegister.h"
+#include "UObject/UnrealType.h"
+
+bool FEasyDataTableNumericColumn::IsNumericProperty(const FProperty* Property)
+{
+	const FNumericProperty* NumericProp = CastField<const FNumericProperty>(Property);
+	return NumericProp && NumericProp->ArrayDim == 1 && !NumericProp->IsEnum();
+}
+
+void FEasyDataTableNumericColumn::Build(const FProperty* Property, const TMap<FName, uint8*>& RowMap)
+{
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Indices);
+	const FNumericProperty* NumericProp = CastFieldChecked<const FNumericProperty>(Property);
+
+	Values.Reset(RowMap.Num());
+	if (NumericProp->IsFloatingPoint())
+	{
+		for (const TPair<FName, uint8*>& Row : RowMap)
+		{
+			Values.Add(NumericProp->GetFloatingPointPropertyValue(NumericProp->ContainerPtrToValuePtr<void>(Row.Value)));
+		}
+	}
+	else
+	{
+		for (const TPair<FName, uint8*>& Row : RowMap)
+		{
+			Values.Add(static_cast<double>(NumericProp->GetSignedIntPropertyValue(NumericProp->ContainerPtrToValuePtr<void>(Row.Value))));
+		}
+	}
+}
+
+void FEasyDataTableNumericColumn::UpdateValue(const FProperty* Property, int32 RowIndex, const uint8* RowData)
+{
+	const FNumericProperty* NumericProp = CastFieldChecked<const FNumericProperty>(Property);
+	if (!Values.IsValidIndex(RowIndex))
+	{
+		return;
+	}
+
+	const void* ValuePtr = NumericProp->ContainerPtrToValuePtr<void>(RowData);
+	Values[RowIndex] = NumericProp->IsFloatingPoint()
+		? NumericProp->GetFloatingPointPropertyValue(ValuePtr)
+		: static_cast<double>(NumericProp->GetSignedIntPropertyValue(ValuePtr));
+}
+
+namespace EasyDataTableNumericColumn
+{
+	/** Stats of the values; only the count, min, max and a mean that is not finite if a value is not finite */
+	static FEasyDataTableNumericStats ComputeStats(TConstArrayView<double> Values, int32 NumHistogramBins)
+	{
+		FEasyDataTableNumericStats Stats;
+		Stats.Count = Values.Num();
+		if (Values.IsEmpty())
+		{
+			return Stats;
+		}
+
+		const double* Data = Values.GetData();
+		const int32 NumValues = Values.Num();
+		const int32 NumVectorValues = NumValues & ~3;
+
+		// Four lanes at a time, the remainder is folded in after the horizontal reduction
+		VectorRegister4Double MinVector = VectorSetFloat1(Data[0]);
+		VectorRegister4Double MaxVector = MinVector;
+		VectorRegister4Double SumVector = VectorZeroDouble();
+		for (int32 Index = 0; Index < NumVectorValues; Index += 4)
+		{
+			const VectorRegister4Double Value = VectorLoad(Data + Index);
+			MinVector = VectorMin(MinVector, Value);
+			MaxVector = VectorMax(MaxVector, Value);
+			SumVector = VectorAdd(SumVector, Value);
+		}
+
+		alignas(16) double Lanes[4];
+		VectorStore(MinVector, Lanes);
+		double Min = FMath::Min(FMath::Min(Lanes[0], Lanes[1]), FMath::Min(Lanes[2], Lanes[3]));
+		VectorStore(MaxVector, Lanes);
+		double Max = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+		VectorStore(SumVector, Lanes);
+		double Sum = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+		for (int32 Index = NumVectorValues; Index < NumValues; ++Index)
+		{
+			Min = FMath::Min(Min, Data[Index]);
+			Max = FMath::Max(Max, Data[Index]);
+			Sum += Data[Index];
+		}
+
+		const double Mean = Sum / NumValues;
+		Stats.Min = Min;
+		Stats.Max = Max;
+		Stats.Mean = Mean;
+		if (!FMath::IsFinite(Mean))
+		{
+			// NaN and infinity propagate to the sum, the caller drops them and computes the stats again
+			return Stats;
+		}
+
+		// Second pass over the deviations, more stable than the sum of squares
+		const VectorRegister4Double MeanVector = VectorSetFloat1(Mean);
+		VectorRegister4Double SquaredSumVector = VectorZeroDouble();
+		for (int32 Index = 0; Index < NumVectorValues; Index += 4)
+		{
+			const VectorRegister4Double Deviation = VectorSubtract(VectorLoad(Data + Index), MeanVector);
+			SquaredSumVector = VectorMultiplyAdd(Deviation, Deviation, SquaredSumVector);
+		}
+		VectorStore(SquaredSumVector, Lanes);
+		double SquaredSum = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+		for (int32 Index = NumVectorValues; Index < NumValues; ++Index)
+		{
+			SquaredSum += FMath::Square(Data[Index] - Mean);
+		}
+
+		Stats.StdDev = FMath::Sqrt(SquaredSum / NumValues);
+
+		if (NumHistogramBins > 0)
+		{
+			Stats.Histogram.SetNumZeroed(NumHistogramBins);
+
+			// A range too wide for a double puts every value in the first bin
+			const double Range = Max - Min;
+			const double BinScale = (Range > 0.0 && FMath::IsFinite(Range)) ? NumHistogramBins / Range : 0.0;
+			for (int32 Index = 0; Index < NumValues; ++Index)
+			{
+				const int32 Bin = BinScale > 0.0 ? FMath::Clamp(static_cast<int32>((Data[Index] - Min) * BinScale), 0, NumHistogramBins - 1) : 0;
+				++Stats.Histogram[Bin];
+			}
+		}
+
+		return Stats;
+	}
+}
+
+FEasyDataTableNumericStats FEasyDataTableNumericColumn::ComputeStats(int32 NumHistogramBins) const
+{
+	FEasyDataTableNumericStats Stats = EasyDataTableNumericColumn::ComputeStats(Values, NumHistogramBins);
+	if (FMath::IsFinite(Stats.Mean))
+	{
+		return Stats;
+	}
+
+	// Float and double columns may hold NaN or infinity, which are left out
+	TArray<double> FiniteValues;
+	FiniteValues.Reserve(Values.Num());
+	for (const double Value : Values)
+	{
+		if (FMath::IsFinite(Value))
+		{
+			FiniteValues.Add(Value);
+		}
+	}
+	return EasyDataTableNumericColumn::ComputeStats(FiniteValues, NumHistogramBins);
+}
+
+void FEasyDataTableNumericColumn::FilterRange(double MinValue, double MaxValue, TBitArray<>& InOutRowMask) const
+{
+	const int32 NumValues = FMath::Min(Values.Num(), InOutRowMask.Num());
+	const double* Data = Values.GetData();
+	for (int32 Index = 0; Index < NumValues; ++Index)
+	{
+		if (Data[Index] < MinValue || Data[Index] > MaxValue)
+		{
+			InOutRowMask[Index] = false;
+		}
+	}
+}
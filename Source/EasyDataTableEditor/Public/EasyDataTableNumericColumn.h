@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Summary of the values of a numeric column */
+struct FEasyDataTableNumericStats
+{
+	int32 Count = 0;
+	double Min = 0.0;
+	double Max = 0.0;
+	double Mean = 0.0;
+	double StdDev = 0.0;
+
+	/** Number of values in each of the equally sized bins between Min and Max */
+	TArray<int32> Histogram;
+};
+
+/**
+ * Values of an int, float or double column stored contiguously in row order, so that range filters, statistics
+ * and sort keys are plain loops over an array instead of parsing cell text. Values are widened to double,
+ * integers beyond 2^53 lose precision.
+ */
+struct EASYDATATABLEEDITOR_API FEasyDataTableNumericColumn
+{
+	/** Index of the column in the table model */
+	int32 ColumnIndex = INDEX_NONE;
+
+	/** Value of each row, indexed by FEasyDataTableEditorRowListViewData::CellIndex */
+	TArray<double> Values;
+
+	/** True if the property can be stored in a numeric column */
+	static bool IsNumericProperty(const FProperty* Property);
+
+	/** Reads the value of every row, reusing the allocation */
+	void Build(const FProperty* Property, const TMap<FName, uint8*>& RowMap);
+
+	/** Re-reads the value of a single row after it was edited in place */
+	void UpdateValue(const FProperty* Property, int32 RowIndex, const uint8* RowData);
+
+	/** Count, min, max, mean, standard deviation and histogram of the values, leaving out NaN and infinity */
+	FEasyDataTableNumericStats ComputeStats(int32 NumHistogramBins = 0) const;
+
+	/** Clears the bit of every row whose value is outside [MinValue, MaxValue] */
+	void FilterRange(double MinValue, double MaxValue, TBitArray<>& InOutRowMask) const;
+};
@@ -0,0 +1,117 @@
+#include "EasyDataTableRowNameIndex.h"
+
+#include "Algo/BinarySearch.h"
+#include "EasyDataTableEditorStats.h"
+#include "Misc/StringBuilder.h"
+
+namespace EasyDataTableRowNameIndex
+{
+	/** True if the characters of the query appear in order in the name */
+	static bool ContainsInOrder(FStringView Name, FStringView Query)
+	{
+		int32 QueryIndex = 0;
+		for (int32 NameIndex = 0; NameIndex < Name.Len() && QueryIndex < Query.Len(); ++NameIndex)
+		{
+			if (Name[NameIndex] == Query[QueryIndex])
+			{
+				++QueryIndex;
+			}
+		}
+		return QueryIndex == Query.Len();
+	}
+}
+
+void FEasyDataTableRowNameIndex::Build(TConstArrayView<FEasyDataTableEditorRowListViewDataPtr> Rows)
+{
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Indices);
+	Reset();
+
+	NameOffsets.Reserve(Rows.Num() + 1);
+	TStringBuilder<FName::StringBufferSize> NameBuilder;
+	for (const FEasyDataTableEditorRowListViewDataPtr& RowData : Rows)
+	{
+		NameOffsets.Add(NameChars.Num());
+
+		NameBuilder.Reset();
+		RowData->RowId.AppendString(NameBuilder);
+		for (const TCHAR Char : FStringView(NameBuilder))
+		{
+			NameChars.Add(FChar::ToLower(Char));
+		}
+	}
+	NameOffsets.Add(NameChars.Num());
+
+	RowsByName.SetNumUninitialized(Rows.Num());
+	for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+	{
+		RowsByName[RowIndex] = RowIndex;
+	}
+	RowsByName.Sort([this](int32 A, int32 B)
+	{
+		return GetName(A).Compare(GetName(B), ESearchCase::CaseSensitive) < 0;
+	});
+
+	bIsBuilt = true;
+}
+
+void FEasyDataTableRowNameIndex::Reset()
+{
+	NameChars.Reset();
+	NameOffsets.Reset();
+	RowsByName.Reset();
+	bIsBuilt = false;
+}
+
+void FEasyDataTableRowNameIndex::Find(FStringView Query, TArray<int32>& OutRowIndices) const
+{
+	OutRowIndices.Reset();
+
+	const int32 NumRows = RowsByName.Num();
+	if (Query.IsEmpty())
+	{
+		OutRowIndices.SetNumUninitialized(NumRows);
+		for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+		{
+			OutRowIndices[RowIndex] = RowIndex;
+		}
+		return;
+	}
+
+	TStringBuilder<FName::StringBufferSize> LowerQueryBuilder;
+	for (const TCHAR Char : Query)
+	{
+		LowerQueryBuilder.AppendChar(FChar::ToLower(Char));
+	}
+	const FStringView LowerQuery(LowerQueryBuilder);
+
+	// Names starting with the query are contiguous in name order
+	TBitArray<> IsPrefixMatch(false, NumRows);
+	int32 SortedIndex = Algo::LowerBound(RowsByName, LowerQuery, [this](int32 RowIndex, FStringView Value)
+	{
+		return GetName(RowIndex).Compare(Value, ESearchCase::CaseSensitive) < 0;
+	});
+	for (; SortedIndex < NumRows && GetName(RowsByName[SortedIndex]).StartsWith(LowerQuery, ESearchCase::CaseSensitive); ++SortedIndex)
+	{
+		const int32 RowIndex = RowsByName[SortedIndex];
+		OutRowIndices.Add(RowIndex);
+		IsPrefixMatch[RowIndex] = true;
+	}
+
+	for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+	{
+		if (!IsPrefixMatch[RowIndex] && EasyDataTableRowNameIndex::ContainsInOrder(GetName(RowIndex), LowerQuery))
+		{
+			OutRowIndices.Add(RowIndex);
+		}
+	}
+}
+
+SIZE_T FEasyDataTableRowNameIndex::GetAllocatedSize() const
+{
+	return NameChars.GetAllocatedSize() + NameOffsets.GetAllocatedSize() + RowsByName.GetAllocatedSize();
+}
+
+FStringView FEasyDataTableRowNameIndex::GetName(int32 RowIndex) const
+{
+	return FStringView(NameChars.GetData() + NameOffsets[RowIndex], NameOffsets[RowIndex + 1] - NameOffsets[RowIndex]);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyDataTableEditorUtils.h"
+
+/**
+ * Search index over the row names of a table. The names are lower-cased into one character buffer and a
+ * name-ordered permutation of the rows answers prefix queries by binary search; queries then fall back to
+ * matching the query characters in order anywhere in the name.
+ */
+class EASYDATATABLEEDITOR_API FEasyDataTableRowNameIndex
+{
+public:
+	void Build(TConstArrayView<FEasyDataTableEditorRowListViewDataPtr> Rows);
+	void Reset();
+
+	bool IsBuilt() const { return bIsBuilt; }
+
+	/**
+	 * Finds the rows whose name matches a query, case-insensitively
+	 *
+	 * @param	OutRowIndices	Indices of the rows given to Build: names starting with the query in name order,
+	 *							then names containing the query characters in order, in row order
+	 */
+	void Find(FStringView Query, TArray<int32>& OutRowIndices) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	FStringView GetName(int32 RowIndex) const;
+
+	/** Lower-cased row names, back to back */
+	TArray<TCHAR> NameChars;
+
+	/** Start of each name in NameChars, with one extra entry for the end of the last name */
+	TArray<int32> NameOffsets;
+
+	/** Row indices ordered by name */
+	TArray<int32> RowsByName;
+
+	bool bIsBuilt = false;
+};
@@ -0,0 +1,213 @@
+#include "SEasyDataTableFacetPanel.h"
+
+#include "Styling/AppStyle.h"
+#include "UObject/UnrealType.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SExpandableArea.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableFacetPanel"
+
+void SEasyDataTableFacetPanel::Construct(const FArguments& InArgs)
+{
+	OnFacetsChanged = InArgs._OnFacetsChanged;
+
+	ChildSlot
+	[
+		SNew(SBorder)
+		.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+		.Padding(FMargin(4.0f))
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 0.0f, 0.0f, 4.0f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("ClearFacets", "Clear Filters"))
+				.ToolTipText(LOCTEXT("ClearFacetsToolTip", "Uncheck every value"))
+				.IsEnabled_Lambda([this]() { return HasActiveFacets(); })
+				.OnClicked_Lambda([this]()
+				{
+					ClearFacets();
+					return FReply::Handled();
+				})
+			]
+			+ SVerticalBox::Slot()
+			[
+				SNew(SScrollBox)
+				+ SScrollBox::Slot()
+				[
+					SAssignNew(FacetsBox, SVerticalBox)
+				]
+			]
+		]
+	];
+}
+
+bool SEasyDataTableFacetPanel::IsFacetProperty(const FProperty* Property)
+{
+	static const FName GameplayTagStructName(TEXT("GameplayTag"));
+
+	if (!Property || Property->ArrayDim != 1)
+	{
+		return false;
+	}
+
+	const FByteProperty* ByteProp = CastField<const FByteProperty>(Property);
+	const FStructProperty* StructProp = CastField<const FStructProperty>(Property);
+	return Property->IsA<FEnumProperty>() || (ByteProp && ByteProp->Enum) || Property->IsA<FBoolProperty>() || Property->IsA<FNameProperty>()
+		|| (StructProp && StructProp->Struct->GetFName() == GameplayTagStructName);
+}
+
+void SEasyDataTableFacetPanel::Refresh(TConstArrayView<FEasyDataTableEditorColumnHeaderDataPtr> Columns)
+{
+	FacetsBox->ClearChildren();
+
+	TSet<FName> FacetColumnIds;
+	for (const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData : Columns)
+	{
+		const int32 NumValues = ColumnData->CellStrings.Num();
+		if (!IsFacetProperty(ColumnData->Property) || NumValues == 0 || NumValues > MaxFacetValues)
+		{
+			continue;
+		}
+		FacetColumnIds.Add(ColumnData->ColumnId);
+
+		// Counted from the interned cells, one pass over the column's cell IDs
+		TArray<int32> Counts;
+		Counts.SetNumZeroed(NumValues);
+		for (const uint32 CellId : ColumnData->RowCellIds)
+		{
+			++Counts[CellId];
+		}
+
+		TArray<int32> SortedCellIds;
+		SortedCellIds.Reserve(NumValues);
+		for (int32 CellId = 0; CellId < NumValues; ++CellId)
+		{
+			SortedCellIds.Add(CellId);
+		}
+		SortedCellIds.Sort([&Counts](int32 A, int32 B)
+		{
+			return Counts[A] != Counts[B] ? Counts[A] > Counts[B] : A < B;
+		});
+
+		TSharedRef<SVerticalBox> ValuesBox = SNew(SVerticalBox);
+		for (const int32 CellId : SortedCellIds)
+		{
+			const FString& Value = ColumnData->CellStrings[CellId];
+			ValuesBox->AddSlot()
+			.AutoHeight()
+			[
+				SNew(SCheckBox)
+				.IsChecked(this, &SEasyDataTableFacetPanel::IsValueChecked, ColumnData->ColumnId, Value)
+				.OnCheckStateChanged(this, &SEasyDataTableFacetPanel::OnValueCheckStateChanged, ColumnData->ColumnId, Value)
+				[
+					SNew(STextBlock)
+					.Text(FText::Format(LOCTEXT("FacetValueFmt", "{0} ({1})"), Value.IsEmpty() ? LOCTEXT("EmptyValue", "(empty)") : FText::FromString(Value), FText::AsNumber(Counts[CellId])))
+				]
+			];
+		}
+
+		FacetsBox->AddSlot()
+		.AutoHeight()
+		.Padding(0.0f, 0.0f, 0.0f, 2.0f)
+		[
+			SNew(SExpandableArea)
+			.AreaTitle(ColumnData->DisplayName)
+			.InitiallyCollapsed(!SelectedValues.Contains(ColumnData->ColumnId))
+			.BodyContent()
+			[
+				ValuesBox
+			]
+		];
+	}
+
+	// Columns that are gone or no longer listed can't filter anymore
+	for (auto It = SelectedValues.CreateIterator(); It; ++It)
+	{
+		if (!FacetColumnIds.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool SEasyDataTableFacetPanel::BuildRowMask(TConstArrayView<FEasyDataTableEditorColumnHeaderDataPtr> Columns, int32 NumRows, TBitArray<>& OutRowMask) const
+{
+	if (SelectedValues.Num() == 0)
+	{
+		return false;
+	}
+
+	OutRowMask.Init(true, NumRows);
+	TBitArray<> ColumnMask;
+	for (const FEasyDataTableEditorColumnHeaderDataPtr& ColumnData : Columns)
+	{
+		const TSet<FString>* ColumnValues = SelectedValues.Find(ColumnData->ColumnId);
+		if (!ColumnValues)
+		{
+			continue;
+		}
+
+		TBitArray<> CheckedCellIds(false, ColumnData->CellStrings.Num());
+		for (int32 CellId = 0; CellId < ColumnData->CellStrings.Num(); ++CellId)
+		{
+			CheckedCellIds[CellId] = ColumnValues->Contains(ColumnData->CellStrings[CellId]);
+		}
+
+		ColumnMask.Init(false, NumRows);
+		const int32 NumCells = FMath::Min(NumRows, ColumnData->RowCellIds.Num());
+		for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+		{
+			if (CheckedCellIds[ColumnData->RowCellIds[CellIndex]])
+			{
+				ColumnMask[CellIndex] = true;
+			}
+		}
+
+		OutRowMask.CombineWithBitwiseAND(ColumnMask, EBitwiseOperatorFlags::MaintainSize);
+	}
+
+	return true;
+}
+
+void SEasyDataTableFacetPanel::ClearFacets()
+{
+	if (SelectedValues.Num() > 0)
+	{
+		SelectedValues.Reset();
+		OnFacetsChanged.ExecuteIfBound();
+	}
+}
+
+ECheckBoxState SEasyDataTableFacetPanel::IsValueChecked(FName ColumnId, FString Value) const
+{
+	const TSet<FString>* ColumnValues = SelectedValues.Find(ColumnId);
+	return ColumnValues && ColumnValues->Contains(Value) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SEasyDataTableFacetPanel::OnValueCheckStateChanged(ECheckBoxState NewState, FName ColumnId, FString Value)
+{
+	if (NewState == ECheckBoxState::Checked)
+	{
+		SelectedValues.FindOrAdd(ColumnId).Add(Value);
+	}
+	else if (TSet<FString>* ColumnValues = SelectedValues.Find(ColumnId))
+	{
+		ColumnValues->Remove(Value);
+		if (ColumnValues->Num() == 0)
+		{
+			SelectedValues.Remove(ColumnId);
+		}
+	}
+
+	OnFacetsChanged.ExecuteIfBound();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/UnrealString.h"
+#include "EasyDataTableEditorUtils.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/NameTypes.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SCompoundWidget.h"
+
+class SVerticalBox;
+
+/**
+ * Side panel of the Data Table editor listing the distinct values of low-cardinality columns (enums, bools,
+ * names, gameplay tags) with their row counts. Checked values filter the rows; values checked in the same
+ * column are alternatives, different columns must all match.
+ */
+class SEasyDataTableFacetPanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SEasyDataTableFacetPanel)
+	{}
+		/** Called when a value is checked or unchecked */
+		SLATE_EVENT(FSimpleDelegate, OnFacetsChanged)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Recounts the values after the cached columns changed, checked values that still exist stay checked */
+	void Refresh(TConstArrayView<FEasyDataTableEditorColumnHeaderDataPtr> Columns);
+
+	/**
+	 * Builds the mask of rows passing the checked values, indexed by FEasyDataTableEditorRowListViewData::CellIndex
+	 *
+	 * @return	False if no value is checked, OutRowMask is left untouched
+	 */
+	bool BuildRowMask(TConstArrayView<FEasyDataTableEditorColumnHeaderDataPtr> Columns, int32 NumRows, TBitArray<>& OutRowMask) const;
+
+	bool HasActiveFacets() const { return SelectedValues.Num() > 0; }
+
+	void ClearFacets();
+
+private:
+	/** Columns with more distinct values than this are not listed */
+	static constexpr int32 MaxFacetValues = 64;
+
+	static bool IsFacetProperty(const FProperty* Property);
+
+	ECheckBoxState IsValueChecked(FName ColumnId, FString Value) const;
+	void OnValueCheckStateChanged(ECheckBoxState NewState, FName ColumnId, FString Value);
+
+	FSimpleDelegate OnFacetsChanged;
+
+	TSharedPtr<SVerticalBox> FacetsBox;
+
+	/** Checked values by column ID, kept as strings because cell IDs change when the table is rebuilt */
+	TMap<FName, TSet<FString>> SelectedValues;
+};
@@ -0,0 +1,21 @@
+#include "SEasyDataTableLazyContent.h"
+
+void SEasyDataTableLazyContent::Construct(const FArguments& InArgs)
+{
+	OnCreateContent = InArgs._OnCreateContent;
+
+	// Active timers only run while their widget is painted
+	RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SEasyDataTableLazyContent::CreateContent));
+}
+
+EActiveTimerReturnType SEasyDataTableLazyContent::CreateContent(double InCurrentTime, float InDeltaTime)
+{
+	if (OnCreateContent.IsBound())
+	{
+		ChildSlot
+		[
+			OnCreateContent.Execute()
+		];
+	}
+	return EActiveTimerReturnType::Stop;
+}
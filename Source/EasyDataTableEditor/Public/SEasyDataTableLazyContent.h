@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Framework/SlateDelegates.h"
+#include "Templates/SharedPointer.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SCompoundWidget.h"
+
+/**
+ * Tab content that is only created the first time it is painted. Tabs in the background of a stack, and the
+ * tabs of a background editor, are not painted, so their content costs nothing until they are brought to front.
+ */
+class SEasyDataTableLazyContent : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SEasyDataTableLazyContent)
+	{}
+		/** Creates the content, called once */
+		SLATE_EVENT(FOnGetContent, OnCreateContent)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	EActiveTimerReturnType CreateContent(double InCurrentTime, float InDeltaTime);
+
+	FOnGetContent OnCreateContent;
+};
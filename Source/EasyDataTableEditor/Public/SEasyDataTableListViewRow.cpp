@@ -3,6 +3,7 @@
 #include "Containers/Map.h"
 #include "EasyDataTableEditor.h"
 #include "DataTableUtils.h"
+#include "EasyDataTableEditorStats.h"
 #include "Delegates/Delegate.h"
 #include "Editor.h"
 #include "Engine/DataTable.h"
@@ -30,6 +31,10 @@
 #include "Textures/SlateIcon.h"
 #include "UObject/UnrealNames.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSpinBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/SBoxPanel.h"
@@ -45,9 +50,114 @@ struct FSlateBrush;
 
 #define LOCTEXT_NAMESPACE "SEasyDataTableListViewRowName"
 
+namespace EasyDataTableListViewRow
+{
+	/** Range of an integer property; OutMin is 0 for unsigned properties */
+	static void GetIntegerRange(const FNumericProperty* Property, int64& OutMin, uint64& OutMax)
+	{
+		OutMin = 0;
+		OutMax = TNumericLimits<uint64>::Max();
+		if (Property->IsA<FInt8Property>())
+		{
+			OutMin = TNumericLimits<int8>::Min();
+			OutMax = TNumericLimits<int8>::Max();
+		}
+		else if (Property->IsA<FInt16Property>())
+		{
+			OutMin = TNumericLimits<int16>::Min();
+			OutMax = TNumericLimits<int16>::Max();
+		}
+		else if (Property->IsA<FIntProperty>())
+		{
+			OutMin = TNumericLimits<int32>::Min();
+			OutMax = TNumericLimits<int32>::Max();
+		}
+		else if (Property->IsA<FInt64Property>())
+		{
+			OutMin = TNumericLimits<int64>::Min();
+			OutMax = TNumericLimits<int64>::Max();
+		}
+		else if (Property->IsA<FByteProperty>())
+		{
+			OutMax = TNumericLimits<uint8>::Max();
+		}
+		else if (Property->IsA<FUInt16Property>())
+		{
+			OutMax = TNumericLimits<uint16>::Max();
+		}
+		else if (Property->IsA<FUInt32Property>())
+		{
+			OutMax = TNumericLimits<uint32>::Max();
+		}
+	}
+
+	/**
+	 * Parses a whole decimal number within the range of an integer property, without going through double
+	 *
+	 * @param	OutValue	The number in canonical form, e.g. "-12" for " -012"
+	 * @return	False if the text is not a whole number or lies outside the range
+	 */
+	static bool ParseInteger(const FNumericProperty* Property, const FString& Text, FString& OutValue)
+	{
+		const FString Trimmed = Text.TrimStartAndEnd();
+		int32 Index = 0;
+		const bool bNegative = Trimmed.Len() > 0 && Trimmed[0] == TEXT('-');
+		if (Trimmed.Len() > 0 && (Trimmed[0] == TEXT('-') || Trimmed[0] == TEXT('+')))
+		{
+			++Index;
+		}
+		if (Index == Trimmed.Len())
+		{
+			return false;
+		}
+
+		uint64 Magnitude = 0;
+		for (; Index < Trimmed.Len(); ++Index)
+		{
+			const TCHAR Char = Trimmed[Index];
+			if (Char < TEXT('0') || Char > TEXT('9'))
+			{
+				return false;
+			}
+
+			const uint64 Digit = Char - TEXT('0');
+			if (Magnitude > (TNumericLimits<uint64>::Max() - Digit) / 10)
+			{
+				return false;
+			}
+			Magnitude = Magnitude * 10 + Digit;
+		}
+
+		int64 Min = 0;
+		uint64 Max = 0;
+		GetIntegerRange(Property, Min, Max);
+
+		if (bNegative && Magnitude != 0)
+		{
+			// Magnitude of Min without negating it, -INT64_MIN overflows
+			const uint64 MinMagnitude = static_cast<uint64>(-(Min + 1)) + 1;
+			if (Min == 0 || Magnitude > MinMagnitude)
+			{
+				return false;
+			}
+			OutValue = LexToString(static_cast<int64>(0 - Magnitude));
+			return true;
+		}
+
+		if (Magnitude > Max)
+		{
+			return false;
+		}
+		OutValue = LexToString(Magnitude);
+		return true;
+	}
+}
+
 void SEasyDataTableListViewRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
 {
 	RowDataPtr = InArgs._RowDataPtr;
+	EditingColumnIndex = INDEX_NONE;
+	PendingCellEditColumnOffset = 0;
 	CurrentName = MakeShareable(new FName(RowDataPtr->RowId));
 	DataTableEditor = InArgs._DataTableEditor;
 	IsEditable = InArgs._IsEditable;
@@ -64,9 +174,26 @@ void SEasyDataTableListViewRow::Construct(const FArguments& InArgs, const TShare
 
 }
 
+FReply SEasyDataTableListViewRow::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	// Ctrl and shift select several rows, which the single selection list view does not do itself
+	if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton && (MouseEvent.IsControlDown() || MouseEvent.IsShiftDown()))
+	{
+		if (TSharedPtr<FEasyDataTableEditor> DataTableEditorPinned = DataTableEditor.Pin())
+		{
+			if (DataTableEditorPinned->ApplyModifierClick(RowDataPtr, MouseEvent.IsControlDown(), MouseEvent.IsShiftDown()))
+			{
+				return FReply::Handled();
+			}
+		}
+	}
+
+	return SMultiColumnTableRow<FEasyDataTableEditorRowListViewDataPtr>::OnMouseButtonDown(MyGeometry, MouseEvent);
+}
+
 FReply SEasyDataTableListViewRow::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
-	if (IsEditable && MouseEvent.GetEffectingButton() == EKeys::RightMouseButton && RowDataPtr.IsValid() && FEditorDelegates::OnOpenReferenceViewer.IsBound() && DataTableEditor.IsValid())
+	if (IsEditable && MouseEvent.GetEffectingButton() == EKeys::RightMouseButton && RowDataPtr && FEditorDelegates::OnOpenReferenceViewer.IsBound() && DataTableEditor.IsValid())
 	{
 		FEasyDataTableEditorUtils::SelectRow(DataTableEditor.Pin()->GetDataTable(), RowDataPtr->RowId);
 
@@ -82,7 +209,7 @@ FReply SEasyDataTableListViewRow::OnMouseButtonUp(const FGeometry& MyGeometry, c
 
 void SEasyDataTableListViewRow::OnSearchForReferences()
 {
-	if (DataTableEditor.IsValid() && RowDataPtr.IsValid())
+	if (DataTableEditor.IsValid() && RowDataPtr)
 	{
 		if (FEasyDataTableEditor* DataTableEditorPtr = DataTableEditor.Pin().Get())
 		{
@@ -98,7 +225,7 @@ void SEasyDataTableListViewRow::OnSearchForReferences()
 
 void SEasyDataTableListViewRow::OnInsertNewRow(ERowInsertionPosition InsertPosition)
 {
-	if (DataTableEditor.IsValid() && RowDataPtr.IsValid())
+	if (DataTableEditor.IsValid() && RowDataPtr)
 	{
 		if (FEasyDataTableEditor* DataTableEditorPtr = DataTableEditor.Pin().Get())
 		{
@@ -187,6 +314,45 @@ FReply SEasyDataTableListViewRow::OnKeyDown(const FGeometry& MyGeometry, const F
 	return FReply::Unhandled();
 }
 
+FReply SEasyDataTableListViewRow::OnPreviewKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
+{
+	if (EditingColumnIndex == INDEX_NONE)
+	{
+		return FReply::Unhandled();
+	}
+
+	const FKey Key = InKeyEvent.GetKey();
+	if (Key == EKeys::Escape)
+	{
+		EndCellEdit();
+		FocusListView();
+		return FReply::Handled();
+	}
+
+	if (Key == EKeys::Tab)
+	{
+		// Text editors commit when they lose focus and move the edit on from there, see CommitCellEdit
+		const int32 ColumnIndex = EditingColumnIndex;
+		PendingCellEditColumnOffset = InKeyEvent.IsShiftDown() ? -1 : 1;
+		FocusListView();
+
+		// Checkboxes and enum menus already wrote their value when it changed
+		if (EditingColumnIndex != INDEX_NONE)
+		{
+			EndCellEdit();
+			if (TSharedPtr<FEasyDataTableEditor> DataTableEditorPtr = DataTableEditor.Pin())
+			{
+				DataTableEditorPtr->MoveCellEdit(RowDataPtr, ColumnIndex, 0, PendingCellEditColumnOffset);
+			}
+		}
+
+		PendingCellEditColumnOffset = 0;
+		return FReply::Handled();
+	}
+
+	return FReply::Unhandled();
+}
+
 void SEasyDataTableListViewRow::OnRowRenamed(const FText& Text, ETextCommit::Type CommitType)
 {
 	UDataTable* DataTable = Cast<UDataTable>(DataTableEditor.Pin()->GetEditingObject());
@@ -244,6 +410,7 @@ void SEasyDataTableListViewRow::OnRowRenamed(const FText& Text, ETextCommit::Typ
 
 TSharedRef<SWidget> SEasyDataTableListViewRow::GenerateWidgetForColumn(const FName& ColumnName)
 {
+	LLM_SCOPE_BYTAG(EasyDataTableEditor_Widgets);
 	TSharedPtr<FEasyDataTableEditor> DataTableEditorPtr = DataTableEditor.Pin();
 	return (DataTableEditorPtr.IsValid())
 		? MakeCellWidget(IndexInList, ColumnName)
@@ -275,6 +442,21 @@ TSharedRef<SWidget> SEasyDataTableListViewRow::MakeCellWidget(const int32 InRowI
 			.ParentRow(SharedThis(this));
 	}
 
+	const FName RowModifiedColumnId("RowModified");
+
+	if (InColumnId.IsEqual(RowModifiedColumnId))
+	{
+		return SNew(SBox)
+			.HAlign(HAlign_Center)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SImage)
+				.Image(FAppStyle::GetBrush("PropertyWindow.DiffersFromDefault"))
+				.Visibility(DataTableEdit, &FEasyDataTableEditor::GetRowModifiedMarkerVisibility, RowDataPtr)
+				.ToolTipText(LOCTEXT("RowModifiedTooltip", "This row differs from the struct defaults"))
+			];
+	}
+
 	const FName RowNumberColumnId("RowNumber");
 
 	if (InColumnId.IsEqual(RowNumberColumnId))
@@ -316,38 +498,313 @@ TSharedRef<SWidget> SEasyDataTableListViewRow::MakeCellWidget(const int32 InRowI
 	}
 	 
 	// Valid column ID?
-	if (AvailableColumns.IsValidIndex(ColumnIndex) && RowDataPtr->CellData.IsValidIndex(ColumnIndex))
+	if (AvailableColumns.IsValidIndex(ColumnIndex) && AvailableColumns[ColumnIndex]->RowCellIds.IsValidIndex(RowDataPtr->CellIndex))
 	{
-		return SNew(SBox)
+		if (CellBoxes.Num() < AvailableColumns.Num())
+		{
+			CellBoxes.SetNum(AvailableColumns.Num());
+		}
+
+		return SAssignNew(CellBoxes[ColumnIndex], SBox)
 			.Padding(FMargin(4, 2, 4, 2))
 			[
-				SNew(STextBlock)
-				.TextStyle(FAppStyle::Get(), "DataTableEditor.CellText")
-				.ColorAndOpacity(DataTableEdit, &FEasyDataTableEditor::GetRowTextColor, RowDataPtr->RowId)
-				.Text(DataTableEdit, &FEasyDataTableEditor::GetCellText, RowDataPtr, ColumnIndex)
-				.HighlightText(DataTableEdit, &FEasyDataTableEditor::GetFilterText)
-				.ToolTipText(DataTableEdit, &FEasyDataTableEditor::GetCellToolTipText, RowDataPtr, ColumnIndex)
+				MakeCellTextWidget(ColumnIndex)
 			];
 	}
 
 	return SNullWidget::NullWidget;
 }
 
-FName SEasyDataTableListViewRow::GetCurrentName() const
+TSharedRef<SWidget> SEasyDataTableListViewRow::MakeCellTextWidget(int32 ColumnIndex)
 {
-	return CurrentName.IsValid() ? *CurrentName : NAME_None;
+	FEasyDataTableEditor* DataTableEdit = DataTableEditor.Pin().Get();
 
+	return SNew(STextBlock)
+		.TextStyle(FAppStyle::Get(), "DataTableEditor.CellText")
+		.ColorAndOpacity(DataTableEdit, &FEasyDataTableEditor::GetRowTextColor, RowDataPtr->RowId)
+		.Text(DataTableEdit, &FEasyDataTableEditor::GetCellText, RowDataPtr, ColumnIndex)
+		.HighlightText(DataTableEdit, &FEasyDataTableEditor::GetFilterText)
+		.ToolTipText(DataTableEdit, &FEasyDataTableEditor::GetCellToolTipText, RowDataPtr, ColumnIndex);
 }
 
-uint32 SEasyDataTableListViewRow::GetCurrentIndex() const
+TSharedRef<SWidget> SEasyDataTableListViewRow::MakeCellEditorWidget(int32 ColumnIndex)
 {
-	return RowDataPtr.IsValid() ? RowDataPtr->RowNum : -1;
+	TSharedPtr<FEasyDataTableEditor> DataTableEditorPtr = DataTableEditor.Pin();
+	const FEasyDataTableEditorColumnHeaderData& ColumnData = *DataTableEditorPtr->AvailableColumns[ColumnIndex];
+	const FProperty* Property = ColumnData.Property;
+
+	const UDataTable* DataTable = DataTableEditorPtr->GetDataTable();
+	const uint8* RowData = DataTable ? DataTable->FindRowUnchecked(RowDataPtr->RowId) : nullptr;
+	if (!RowData)
+	{
+		return SNullWidget::NullWidget;
+	}
+	const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(RowData);
+
+	CellEditInitialText = ColumnData.GetCellString(RowDataPtr->CellIndex);
+
+	const UEnum* Enum = nullptr;
+	if (const FEnumProperty* EnumProp = CastField<const FEnumProperty>(Property))
+	{
+		Enum = EnumProp->GetEnum();
+	}
+	else if (const FNumericProperty* NumericProp = CastField<const FNumericProperty>(Property))
+	{
+		Enum = NumericProp->GetIntPropertyEnum();
+	}
+
+	if (Enum)
+	{
+		return SAssignNew(CellEnumComboButton, SComboButton)
+			.ButtonContent()
+			[
+				SNew(STextBlock)
+				.TextStyle(FAppStyle::Get(), "DataTableEditor.CellText")
+				.Text(FText::FromString(CellEditInitialText))
+			]
+			.OnGetMenuContent(this, &SEasyDataTableListViewRow::MakeEnumCellMenu, Enum, ColumnIndex)
+			.OnMenuOpenChanged(this, &SEasyDataTableListViewRow::OnEnumCellMenuOpenChanged);
+	}
+
+	if (const FNumericProperty* NumericProp = CastField<const FNumericProperty>(Property))
+	{
+		if (NumericProp->IsInteger())
+		{
+			// A double spin box cannot hold every int64 or uint64 value, so integers are typed and parsed exactly
+			int64 Min = 0;
+			uint64 Max = 0;
+			EasyDataTableListViewRow::GetIntegerRange(NumericProp, Min, Max);
+			CellEditInitialText = Min < 0 ? LexToString(NumericProp->GetSignedIntPropertyValue(ValuePtr)) : LexToString(NumericProp->GetUnsignedIntPropertyValue(ValuePtr));
+
+			return SNew(SEditableTextBox)
+				.Text(FText::FromString(CellEditInitialText))
+				.SelectAllTextWhenFocused(true)
+				.RevertTextOnEscape(true)
+				.OnVerifyTextChanged(this, &SEasyDataTableListViewRow::OnVerifyIntegerCellText)
+				.OnTextCommitted(this, &SEasyDataTableListViewRow::OnIntegerCellCommitted);
+		}
+
+		// No MinValue/MaxValue, a bounded spin box turns into a slider over the range; float is clamped on commit
+		CellEditInitialNumber = NumericProp->GetFloatingPointPropertyValue(ValuePtr);
+		return SNew(SSpinBox<double>)
+			.Value(CellEditInitialNumber)
+			.Delta(0.0)
+			.OnValueCommitted(this, &SEasyDataTableListViewRow::OnNumericCellCommitted);
+	}
+
+	if (const FBoolProperty* BoolProp = CastField<const FBoolProperty>(Property))
+	{
+		return SNew(SCheckBox)
+			.IsChecked(BoolProp->GetPropertyValue(ValuePtr) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked)
+			.OnCheckStateChanged(this, &SEasyDataTableListViewRow::OnBoolCellChanged);
+	}
+
+	// Names, strings and texts
+	return SNew(SEditableTextBox)
+		.Text(FText::FromString(CellEditInitialText))
+		.SelectAllTextWhenFocused(true)
+		.RevertTextOnEscape(true)
+		.OnTextCommitted(this, &SEasyDataTableListViewRow::OnTextCellCommitted);
+}
+
+TSharedRef<SWidget> SEasyDataTableListViewRow::MakeEnumCellMenu(const UEnum* Enum, int32 ColumnIndex)
+{
+	FMenuBuilder MenuBuilder(/*bInShouldCloseWindowAfterMenuSelection*/ true, nullptr);
+
+	// The last entry is the generated _MAX value
+	const int32 NumEnums = Enum->ContainsExistingMax() ? Enum->NumEnums() - 1 : Enum->NumEnums();
+	for (int32 EnumIndex = 0; EnumIndex < NumEnums; ++EnumIndex)
+	{
+		if (Enum->HasMetaData(TEXT("Hidden"), EnumIndex))
+		{
+			continue;
+		}
+
+		MenuBuilder.AddMenuEntry(
+			Enum->GetDisplayNameTextByIndex(EnumIndex),
+			FText::GetEmpty(),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SEasyDataTableListViewRow::OnEnumCellPicked, ColumnIndex, Enum->GetNameStringByIndex(EnumIndex))));
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+void SEasyDataTableListViewRow::BeginCellEdit(int32 ColumnIndex)
+{
+	TSharedPtr<FEasyDataTableEditor> DataTableEditorPtr = DataTableEditor.Pin();
+	if (!IsEditable || !DataTableEditorPtr.IsValid() || !CellBoxes.IsValidIndex(ColumnIndex) || !CellBoxes[ColumnIndex].IsValid()
+		|| !FEasyDataTableEditorUtils::CanEditCellInline(DataTableEditorPtr->AvailableColumns[ColumnIndex]->Property))
+	{
+		return;
+	}
+
+	EndCellEdit();
+
+	EditingColumnIndex = ColumnIndex;
+	CellEditorWidget = MakeCellEditorWidget(ColumnIndex);
+	CellBoxes[ColumnIndex]->SetContent(CellEditorWidget.ToSharedRef());
+
+	RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SEasyDataTableListViewRow::FocusCellEditor));
+}
+
+void SEasyDataTableListViewRow::EndCellEdit()
+{
+	if (EditingColumnIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 ColumnIndex = EditingColumnIndex;
+	EditingColumnIndex = INDEX_NONE;
+	CellEnumComboButton.Reset();
+
+	if (CellBoxes.IsValidIndex(ColumnIndex) && CellBoxes[ColumnIndex].IsValid())
+	{
+		CellBoxes[ColumnIndex]->SetContent(MakeCellTextWidget(ColumnIndex));
+	}
+}
+
+void SEasyDataTableListViewRow::CommitCellEdit(const FString& Value, ETextCommit::Type CommitType)
+{
+	// Also reached when an editor loses focus after its edit was cancelled or already committed
+	if (EditingColumnIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 ColumnIndex = EditingColumnIndex;
+	EndCellEdit();
+
+	TSharedPtr<FEasyDataTableEditor> DataTableEditorPtr = DataTableEditor.Pin();
+	if (!DataTableEditorPtr.IsValid() || CommitType == ETextCommit::OnCleared)
+	{
+		return;
+	}
+
+	if (!Value.Equals(CellEditInitialText, ESearchCase::CaseSensitive))
+	{
+		DataTableEditorPtr->SetCellValue(RowDataPtr, ColumnIndex, Value);
+	}
+
+	if (CommitType == ETextCommit::OnEnter)
+	{
+		FocusListView();
+		DataTableEditorPtr->MoveCellEdit(RowDataPtr, ColumnIndex, FSlateApplication::Get().GetModifierKeys().IsShiftDown() ? -1 : 1, 0);
+	}
+	else if (PendingCellEditColumnOffset != 0)
+	{
+		DataTableEditorPtr->MoveCellEdit(RowDataPtr, ColumnIndex, 0, PendingCellEditColumnOffset);
+	}
+}
+
+void SEasyDataTableListViewRow::OnTextCellCommitted(const FText& Text, ETextCommit::Type CommitType)
+{
+	CommitCellEdit(Text.ToString(), CommitType);
+}
+
+void SEasyDataTableListViewRow::OnNumericCellCommitted(double Value, ETextCommit::Type CommitType)
+{
+	const FNumericProperty* NumericProp = GetEditingNumericProperty();
+	if (NumericProp && NumericProp->IsA<FFloatProperty>())
+	{
+		Value = FMath::Clamp(Value, static_cast<double>(TNumericLimits<float>::Lowest()), static_cast<double>(TNumericLimits<float>::Max()));
+	}
+
+	// Losing focus commits the spin box too, an untouched value is not written back
+	CommitCellEdit(Value == CellEditInitialNumber ? CellEditInitialText : FString::SanitizeFloat(Value), CommitType);
+}
+
+const FNumericProperty* SEasyDataTableListViewRow::GetEditingNumericProperty() const
+{
+	TSharedPtr<FEasyDataTableEditor> DataTableEditorPtr = DataTableEditor.Pin();
+	return (DataTableEditorPtr.IsValid() && DataTableEditorPtr->AvailableColumns.IsValidIndex(EditingColumnIndex))
+		? CastField<const FNumericProperty>(DataTableEditorPtr->AvailableColumns[EditingColumnIndex]->Property)
+		: nullptr;
+}
+
+bool SEasyDataTableListViewRow::OnVerifyIntegerCellText(const FText& Text, FText& OutErrorMessage)
+{
+	const FNumericProperty* NumericProp = GetEditingNumericProperty();
+	FString Value;
+	if (!NumericProp || EasyDataTableListViewRow::ParseInteger(NumericProp, Text.ToString(), Value))
+	{
+		return true;
+	}
+
+	int64 Min = 0;
+	uint64 Max = 0;
+	EasyDataTableListViewRow::GetIntegerRange(NumericProp, Min, Max);
+	OutErrorMessage = FText::Format(LOCTEXT("InvalidIntegerCell", "Enter a whole number from {0} to {1}"), FText::FromString(LexToString(Min)), FText::FromString(LexToString(Max)));
+	return false;
+}
+
+void SEasyDataTableListViewRow::OnIntegerCellCommitted(const FText& Text, ETextCommit::Type CommitType)
+{
+	// Text that is not a number in range writes nothing, like an unchanged value
+	const FNumericProperty* NumericProp = GetEditingNumericProperty();
+	FString Value;
+	if (!NumericProp || !EasyDataTableListViewRow::ParseInteger(NumericProp, Text.ToString(), Value))
+	{
+		Value = CellEditInitialText;
+	}
+	CommitCellEdit(Value, CommitType);
+}
+
+void SEasyDataTableListViewRow::OnBoolCellChanged(ECheckBoxState NewState)
+{
+	CommitCellEdit(NewState == ECheckBoxState::Checked ? TEXT("true") : TEXT("false"), ETextCommit::Default);
+}
+
+void SEasyDataTableListViewRow::OnEnumCellPicked(int32 ColumnIndex, FString EnumName)
+{
+	// The menu may close and end the edit before the entry's action runs, so the column is bound to the entry
+	if (TSharedPtr<FEasyDataTableEditor> DataTableEditorPtr = DataTableEditor.Pin())
+	{
+		DataTableEditorPtr->SetCellValue(RowDataPtr, ColumnIndex, EnumName);
+	}
+	EndCellEdit();
+}
+
+void SEasyDataTableListViewRow::OnEnumCellMenuOpenChanged(bool bIsOpen)
+{
+	if (!bIsOpen)
+	{
+		EndCellEdit();
+	}
 }
 
-const TArray<FText>& SEasyDataTableListViewRow::GetCellValues() const
+EActiveTimerReturnType SEasyDataTableListViewRow::FocusCellEditor(double InCurrentTime, float InDeltaTime)
 {
-	check(RowDataPtr)
-	return RowDataPtr->CellData;
+	if (EditingColumnIndex != INDEX_NONE && CellEditorWidget.IsValid())
+	{
+		FSlateApplication::Get().SetKeyboardFocus(CellEditorWidget, EFocusCause::SetDirectly);
+		if (CellEnumComboButton.IsValid())
+		{
+			CellEnumComboButton->SetIsOpen(true);
+		}
+	}
+	return EActiveTimerReturnType::Stop;
+}
+
+void SEasyDataTableListViewRow::FocusListView()
+{
+	TSharedPtr<FEasyDataTableEditor> DataTableEditorPtr = DataTableEditor.Pin();
+	if (DataTableEditorPtr.IsValid() && DataTableEditorPtr->CellsListView.IsValid())
+	{
+		FSlateApplication::Get().SetKeyboardFocus(DataTableEditorPtr->CellsListView, EFocusCause::SetDirectly);
+	}
+}
+
+FName SEasyDataTableListViewRow::GetCurrentName() const
+{
+	return CurrentName.IsValid() ? *CurrentName : NAME_None;
+
+}
+
+uint32 SEasyDataTableListViewRow::GetCurrentIndex() const
+{
+	return RowDataPtr ? RowDataPtr->RowNum : -1;
 }
 
 FReply SEasyDataTableListViewRow::OnMouseButtonDoubleClick(const FGeometry& InMyGeometry, const FPointerEvent& InMouseEvent)
@@ -357,6 +814,15 @@ FReply SEasyDataTableListViewRow::OnMouseButtonDoubleClick(const FGeometry& InMy
 		InlineEditableText->EnterEditingMode();
 	}
 
+	for (int32 ColumnIndex = 0; ColumnIndex < CellBoxes.Num(); ++ColumnIndex)
+	{
+		if (CellBoxes[ColumnIndex].IsValid() && CellBoxes[ColumnIndex]->IsHovered())
+		{
+			BeginCellEdit(ColumnIndex);
+			break;
+		}
+	}
+
 	return FReply::Handled();
 }
 
@@ -434,6 +900,11 @@ const FSlateBrush* SEasyDataTableListViewRow::GetBorder() const
 	{
 		return FAppStyle::GetBrush("DataTableEditor.DragDropHoveredTarget");
 	}
+	else if (!IsSelected() && DataTableEditor.IsValid() && DataTableEditor.Pin()->IsRowSelected(RowDataPtr))
+	{
+		// Rows selected with ctrl or shift are only tracked by the editor's selection mask
+		return IsHovered() ? &Style->ActiveHoveredBrush : &Style->ActiveBrush;
+	}
 	else
 	{
 		return STableRow::GetBorder();
@@ -11,6 +11,7 @@
 #include "Input/Reply.h"
 #include "InputCoreTypes.h"
 #include "Internationalization/Text.h"
+#include "Styling/SlateTypes.h"
 #include "Templates/SharedPointer.h"
 #include "Templates/UnrealTemplate.h"
 #include "Types/SlateEnums.h"
@@ -21,9 +22,12 @@
 
 class FEasyDataTableEditor;
 class SEasyDataTableListViewRow;
+class SBox;
+class SComboButton;
 class SInlineEditableTextBlock;
 class STableViewBase;
 class SWidget;
+class UEnum;
 struct FGeometry;
 struct FKeyEvent;
 struct FPointerEvent;
@@ -74,11 +78,13 @@ public:
 
 	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
 
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 
 	void OnRowRenamed(const FText& Text, ETextCommit::Type CommitType);
 
 	virtual FReply OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
+	virtual FReply OnPreviewKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
 
 	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
 
@@ -86,8 +92,6 @@ public:
 	FName GetCurrentName() const;
 	uint32 GetCurrentIndex() const;
 
-	const TArray<FText>& GetCellValues() const;
-
 	virtual FReply OnMouseButtonDoubleClick(const FGeometry& InMyGeometry, const FPointerEvent& InMouseEvent);
 
 	void SetRowForRename();
@@ -96,6 +100,14 @@ public:
 
 	const FEasyDataTableEditorRowListViewDataPtr& GetRowDataPtr() const;
 
+	/**
+	 * Swaps the text of a cell for an editor of its value. Enter commits and edits the cell below, Tab the next
+	 * cell to the right, Escape cancels.
+	 *
+	 * @param	ColumnIndex		Index of the column in the editor's AvailableColumns
+	 */
+	void BeginCellEdit(int32 ColumnIndex);
+
 private:
 
 	void OnSearchForReferences();
@@ -105,6 +117,34 @@ private:
 
 	TSharedRef<SWidget> MakeCellWidget(const int32 InRowIndex, const FName& InColumnId);
 
+	/** Read-only text of a data cell */
+	TSharedRef<SWidget> MakeCellTextWidget(int32 ColumnIndex);
+
+	/** Editor of a data cell, made when the cell enters edit mode */
+	TSharedRef<SWidget> MakeCellEditorWidget(int32 ColumnIndex);
+	TSharedRef<SWidget> MakeEnumCellMenu(const UEnum* Enum, int32 ColumnIndex);
+
+	/** Puts the text back into the edited cell without writing its value */
+	void EndCellEdit();
+
+	/** Writes the value of the edited cell and moves on to the next cell if the commit asks for it */
+	void CommitCellEdit(const FString& Value, ETextCommit::Type CommitType);
+
+	void OnTextCellCommitted(const FText& Text, ETextCommit::Type CommitType);
+	void OnNumericCellCommitted(double Value, ETextCommit::Type CommitType);
+	const FNumericProperty* GetEditingNumericProperty() const;
+	bool OnVerifyIntegerCellText(const FText& Text, FText& OutErrorMessage);
+	void OnIntegerCellCommitted(const FText& Text, ETextCommit::Type CommitType);
+	void OnBoolCellChanged(ECheckBoxState NewState);
+	void OnEnumCellPicked(int32 ColumnIndex, FString EnumName);
+	void OnEnumCellMenuOpenChanged(bool bIsOpen);
+
+	/** Focuses the cell editor once it was arranged, and opens it if it is a menu */
+	EActiveTimerReturnType FocusCellEditor(double InCurrentTime, float InDeltaTime);
+
+	/** Gives keyboard focus back to the list view */
+	void FocusListView();
+
 	void OnRowDragEnter(const FDragDropEvent& DragDropEvent);
 	void OnRowDragLeave(const FDragDropEvent& DragDropEvent);
 
@@ -116,6 +156,25 @@ private:
 
 	TSharedPtr<SInlineEditableTextBlock> InlineEditableText;
 
+	/** Box of each data cell, indexed like the editor's AvailableColumns, whose content is swapped while editing */
+	TArray<TSharedPtr<SBox>> CellBoxes;
+
+	/** Column of the cell being edited, INDEX_NONE if no cell is */
+	int32 EditingColumnIndex;
+
+	/** Editor of the edited cell. Kept after the edit ends, as the edit may end inside the editor's own commit callback */
+	TSharedPtr<SWidget> CellEditorWidget;
+	TSharedPtr<SComboButton> CellEnumComboButton;
+
+	/** Text shown when the edit began, committing it unchanged writes nothing */
+	FString CellEditInitialText;
+
+	/** Value of a floating point cell when the edit began */
+	double CellEditInitialNumber = 0.0;
+
+	/** Set while Tab moves focus out of a text editor, so its commit moves the edit by that many columns */
+	int32 PendingCellEditColumnOffset;
+
 	TSharedPtr<FName> CurrentName;
 
 	FEasyDataTableEditorRowListViewDataPtr RowDataPtr;
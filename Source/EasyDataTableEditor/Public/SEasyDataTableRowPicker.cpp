@@ -0,0 +1,121 @@
+#include "SEasyDataTableRowPicker.h"
+
+#include "EasyDataTableEditorModel.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableRowPicker"
+
+void SEasyDataTableRowPicker::Construct(const FArguments& InArgs)
+{
+	Model = InArgs._Model;
+	OnRowPicked = InArgs._OnRowPicked;
+
+	UpdateMatchingRows();
+
+	ChildSlot
+	[
+		SNew(SBox)
+		.WidthOverride(300.0f)
+		.MaxDesiredHeight(400.0f)
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(2.0f)
+			[
+				SAssignNew(SearchBox, SSearchBox)
+				.HintText(LOCTEXT("SearchHint", "Search Rows"))
+				.OnTextChanged(this, &SEasyDataTableRowPicker::OnSearchTextChanged)
+				.OnTextCommitted(this, &SEasyDataTableRowPicker::OnSearchTextCommitted)
+			]
+			+ SVerticalBox::Slot()
+			.FillHeight(1.0f)
+			[
+				SAssignNew(RowsListView, SListView<FEasyDataTableEditorRowListViewDataPtr>)
+				.ListItemsSource(&MatchingRows)
+				.OnGenerateRow(this, &SEasyDataTableRowPicker::MakeRowWidget)
+				.OnSelectionChanged(this, &SEasyDataTableRowPicker::OnRowSelectionChanged)
+				.SelectionMode(ESelectionMode::Single)
+			]
+		]
+	];
+
+	const int32 SelectedRowIndex = Model.IsValid() ? Model->FindRowIndex(InArgs._SelectedRowName) : INDEX_NONE;
+	if (SelectedRowIndex != INDEX_NONE)
+	{
+		RowsListView->SetItemSelection(MatchingRows[SelectedRowIndex], true, ESelectInfo::Direct);
+		RowsListView->RequestScrollIntoView(MatchingRows[SelectedRowIndex]);
+	}
+}
+
+TSharedPtr<SWidget> SEasyDataTableRowPicker::GetWidgetToFocus() const
+{
+	return SearchBox;
+}
+
+void SEasyDataTableRowPicker::UpdateMatchingRows()
+{
+	MatchingRows.Reset();
+	if (!Model.IsValid())
+	{
+		return;
+	}
+
+	TArray<int32> RowIndices;
+	Model->GetRowNameIndex().Find(SearchText.ToString(), RowIndices);
+
+	const TArray<FEasyDataTableEditorRowListViewDataPtr>& Rows = Model->GetRows();
+	MatchingRows.Reserve(RowIndices.Num());
+	for (const int32 RowIndex : RowIndices)
+	{
+		MatchingRows.Add(Rows[RowIndex]);
+	}
+}
+
+void SEasyDataTableRowPicker::OnSearchTextChanged(const FText& InSearchText)
+{
+	SearchText = InSearchText;
+	UpdateMatchingRows();
+
+	if (RowsListView.IsValid())
+	{
+		RowsListView->RequestListRefresh();
+		if (MatchingRows.Num() > 0)
+		{
+			RowsListView->RequestScrollIntoView(MatchingRows[0]);
+		}
+	}
+}
+
+void SEasyDataTableRowPicker::OnSearchTextCommitted(const FText& InSearchText, ETextCommit::Type CommitType)
+{
+	if (CommitType == ETextCommit::OnEnter && MatchingRows.Num() > 0)
+	{
+		OnRowPicked.ExecuteIfBound(MatchingRows[0]->RowId);
+	}
+}
+
+TSharedRef<ITableRow> SEasyDataTableRowPicker::MakeRowWidget(FEasyDataTableEditorRowListViewDataPtr InRowData, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<FEasyDataTableEditorRowListViewDataPtr>, OwnerTable)
+		[
+			SNew(STextBlock)
+			.Text(InRowData->DisplayName)
+			.HighlightText_Lambda([this]() { return SearchText; })
+		];
+}
+
+void SEasyDataTableRowPicker::OnRowSelectionChanged(FEasyDataTableEditorRowListViewDataPtr InRowData, ESelectInfo::Type InSelectInfo)
+{
+	// Keyboard navigation only moves the selection, the row is picked on click or enter
+	if (InRowData && InSelectInfo != ESelectInfo::Direct && InSelectInfo != ESelectInfo::OnNavigation)
+	{
+		OnRowPicked.ExecuteIfBound(InRowData->RowId);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "EasyDataTableEditorUtils.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/NameTypes.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+class FEasyDataTableEditorModel;
+class ITableRow;
+class SSearchBox;
+class STableViewBase;
+
+DECLARE_DELEGATE_OneParam(FOnEasyDataTableRowPicked, FName /*Row name*/);
+
+/**
+ * Searchable list of the rows of a table, shown in the row editor's drop-down. The list is virtualized and its
+ * items are the model's rows, so opening it on a large table only generates the visible entries; the search
+ * goes through the model's row name index.
+ */
+class SEasyDataTableRowPicker : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SEasyDataTableRowPicker)
+	{}
+		SLATE_ARGUMENT(TSharedPtr<FEasyDataTableEditorModel>, Model)
+		/** Name of the row to show as selected */
+		SLATE_ARGUMENT(FName, SelectedRowName)
+		SLATE_EVENT(FOnEasyDataTableRowPicked, OnRowPicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Widget to focus when the picker opens */
+	TSharedPtr<SWidget> GetWidgetToFocus() const;
+
+private:
+	void UpdateMatchingRows();
+
+	void OnSearchTextChanged(const FText& InSearchText);
+	void OnSearchTextCommitted(const FText& InSearchText, ETextCommit::Type CommitType);
+
+	TSharedRef<ITableRow> MakeRowWidget(FEasyDataTableEditorRowListViewDataPtr InRowData, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnRowSelectionChanged(FEasyDataTableEditorRowListViewDataPtr InRowData, ESelectInfo::Type InSelectInfo);
+
+	TSharedPtr<FEasyDataTableEditorModel> Model;
+	FOnEasyDataTableRowPicked OnRowPicked;
+
+	FText SearchText;
+
+	/** Rows matching the search, pointing into the model */
+	TArray<FEasyDataTableEditorRowListViewDataPtr> MatchingRows;
+
+	TSharedPtr<SSearchBox> SearchBox;
+	TSharedPtr<SListView<FEasyDataTableEditorRowListViewDataPtr>> RowsListView;
+};
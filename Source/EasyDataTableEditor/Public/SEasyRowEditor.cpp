@@ -1,5 +1,8 @@
 #include "SEasyRowEditor.h"
+#include "Async/ParallelFor.h"
 #include "Containers/Map.h"
+#include "EasyDataTableEditor.h"
+#include "EasyDataTableEditorModel.h"
 #include "DataTableUtils.h"
 #include "DetailsViewArgs.h"
 #include "Engine/DataTable.h"
@@ -15,6 +18,7 @@
 #include "Misc/MessageDialog.h"
 #include "Modules/ModuleManager.h"
 #include "PropertyEditorModule.h"
+#include "SEasyDataTableRowPicker.h"
 #include "SlotBase.h"
 #include "Styling/AppStyle.h"
 #include "Styling/SlateColor.h"
@@ -63,17 +67,16 @@ void SEasyRowEditor::NotifyPostChange( const FPropertyChangedEvent& PropertyChan
 {
 	check(DataTable.IsValid());
 
-	FName RowName = NAME_None;
-	if (SelectedName.IsValid())
+	// The details view already wrote the new value to every bound row, NotifyPreChange modified the table once for all of them
+	if (BoundRowNames.Num() > 1)
 	{
-		RowName = *SelectedName.Get();
+		FEasyDataTableEditorUtils::BroadcastPostRowsChange(DataTable.Get(), BoundRowNames);
+		return;
 	}
-	
-	DataTable->HandleDataTableChanged(RowName);
-	DataTable->MarkPackageDirty();
-	
-	FEasyDataTableEditorUtils::BroadcastPostChange(DataTable.Get(), FEasyDataTableEditorUtils::EDataTableChangeInfo::RowData);
-	FEasyDataTableEditorUtils::BroadcastPostRowPropertyChange(DataTable.Get(),PropertyChangedEvent,PropertyThatChanged,SharedThis(this));
+
+	// A single bound row is either the whole selection or not selected, so the edit is not mirrored to other rows
+	const FName RowName = SelectedName.IsValid() ? *SelectedName : NAME_None;
+	FEasyDataTableEditorUtils::BroadcastPostRowsChange(DataTable.Get(), MakeArrayView(&RowName, 1));
 }
 
 void SEasyRowEditor::PreChange(const class UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info)
@@ -88,7 +91,6 @@ void SEasyRowEditor::PostChange(const class UUserDefinedStruct* Struct, FStructu
 {
 	if (Struct && (GetScriptStruct() == Struct))
 	{
-		RefreshNameList();
 		Restore();
 	}
 }
@@ -105,9 +107,12 @@ void SEasyRowEditor::PostChange(const UDataTable* Changed, FEasyDataTableEditorU
 {
 	if ((Changed == DataTable.Get()) && (FEasyDataTableEditorUtils::EDataTableChangeInfo::RowList == Info))
 	{
-		RefreshNameList();
 		Restore();
 	}
+	else if ((Changed == DataTable.Get()) && (FEasyDataTableEditorUtils::EDataTableChangeInfo::RowData == Info))
+	{
+		UpdateMixedPropertyNames();
+	}
 }
 
 void SEasyRowEditor::CleanBeforeChange()
@@ -123,67 +128,213 @@ void SEasyRowEditor::CleanBeforeChange()
 	}
 }
 
-void SEasyRowEditor::RefreshNameList()
+void SEasyRowEditor::Restore()
 {
-	CachedRowNames.Empty();
-	if (DataTable.IsValid())
+	if (!SelectedName.IsValid() || !SelectedName->IsNone())
 	{
-		auto RowNames = DataTable->GetRowNames();
-		for (auto RowName : RowNames)
+		if (SelectedName.IsValid())
 		{
-			CachedRowNames.Add(MakeShareable(new FName(RowName)));
+			if (!DataTable.IsValid() || !DataTable->GetRowMap().Contains(*SelectedName))
+			{
+				SelectedName = nullptr;
+			}
+		}
+
+		if (!SelectedName.IsValid() && DataTable.IsValid() && DataTable->GetRowMap().Num() > 0)
+		{
+			SelectedName = MakeShareable(new FName(DataTable->GetRowMap().CreateConstIterator().Key()));
 		}
 	}
+
+	auto FinalName = SelectedName.IsValid() ? *SelectedName : NAME_None;
+	CurrentRow = MakeShareable(new FStructFromDataTable(DataTable.Get(), FinalName));
+	if (StructureDetailsView.IsValid())
+	{
+		StructureDetailsView->SetCustomName(FText::FromName(FinalName));
+		if (!FinalName.IsNone())
+		{
+			BindRows(FinalName);
+		}
+	}
+
+	RowSelectedCallback.ExecuteIfBound(FinalName);
 }
 
-void SEasyRowEditor::Restore()
+void SEasyRowEditor::GatherBoundRowNames(FName CurrentName, TArray<FName>& OutRowNames) const
 {
-	if (!SelectedName.IsValid() || !SelectedName->IsNone())
+	OutRowNames.Reset();
+	OutRowNames.Add(CurrentName);
+
+	if (TSharedPtr<FEasyDataTableEditor> Editor = WeakEditor.Pin())
 	{
-		if (SelectedName.IsValid())
+		TArray<FName> SelectedRowNames;
+		Editor->GetSelectedRowNames(SelectedRowNames);
+		if (SelectedRowNames.Contains(CurrentName))
 		{
-			auto CurrentName = *SelectedName;
-			SelectedName = NULL;
-			for (auto Element : CachedRowNames)
+			for (const FName SelectedRowName : SelectedRowNames)
 			{
-				if (*Element == CurrentName)
+				if (SelectedRowName != CurrentName)
 				{
-					SelectedName = Element;
-					break;
+					OutRowNames.Add(SelectedRowName);
 				}
 			}
 		}
+	}
+}
+
+void SEasyRowEditor::BindRows(FName CurrentName)
+{
+	GatherBoundRowNames(CurrentName, BoundRowNames);
+
+	if (BoundRowNames.Num() > 1)
+	{
+		StructureDetailsView->SetStructureProvider(MakeShared<FEasyDataTableRowsStructureProvider>(DataTable.Get(), BoundRowNames));
+	}
+	else
+	{
+		StructureDetailsView->SetStructureData(CurrentRow);
+	}
+
+	UpdateMixedPropertyNames();
+}
 
-		if (!SelectedName.IsValid() && CachedRowNames.Num() && CachedRowNames[0].IsValid())
+void SEasyRowEditor::UpdateMixedPropertyNames()
+{
+	MixedPropertyNames.Reset();
+
+	const UScriptStruct* RowStruct = GetScriptStruct();
+	if (BoundRowNames.Num() < 2 || !RowStruct)
+	{
+		return;
+	}
+
+	TArray<const uint8*> RowData;
+	RowData.Reserve(BoundRowNames.Num());
+	for (const FName BoundRowName : BoundRowNames)
+	{
+		if (const uint8* Data = DataTable->FindRowUnchecked(BoundRowName))
 		{
-			SelectedName = CachedRowNames[0];
+			RowData.Add(Data);
 		}
+	}
 
-		if (RowComboBox.IsValid())
+	TArray<const FProperty*> Properties;
+	for (TFieldIterator<const FProperty> It(RowStruct); It; ++It)
+	{
+		Properties.Add(*It);
+	}
+
+	if (RowData.Num() < 2 || Properties.Num() == 0)
+	{
+		return;
+	}
+
+	// Properties holding object references may resolve them when compared, so they are compared on the game thread
+	TArray<int32> ParallelPropertyIndices;
+	TArray<int32> GameThreadPropertyIndices;
+	for (int32 PropertyIndex = 0; PropertyIndex < Properties.Num(); ++PropertyIndex)
+	{
+		if (FEasyDataTableEditorUtils::PropertyNeedsGameThread(Properties[PropertyIndex]))
+		{
+			GameThreadPropertyIndices.Add(PropertyIndex);
+		}
+		else
 		{
-			RowComboBox->SetSelectedItem(SelectedName);
+			ParallelPropertyIndices.Add(PropertyIndex);
 		}
 	}
-	else
+
+	auto CompareRow = [&RowData, &Properties](TBitArray<>& MixedProperties, TConstArrayView<int32> PropertyIndices, int32 RowIndex)
 	{
-		if (RowComboBox.IsValid())
+		const uint8* Row = RowData[RowIndex];
+		for (const int32 PropertyIndex : PropertyIndices)
 		{
-			RowComboBox->ClearSelection();
+			const FProperty* Property = Properties[PropertyIndex];
+			for (int32 ArrayIndex = 0; !MixedProperties[PropertyIndex] && ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				if (!Property->Identical_InContainer(RowData[0], Row, ArrayIndex, PPF_None))
+				{
+					MixedProperties[PropertyIndex] = true;
+				}
+			}
 		}
+	};
+
+	// Each task compares its rows with the first one and marks the properties that differ
+	TArray<TBitArray<>> TaskMixedProperties;
+	if (ParallelPropertyIndices.Num() > 0)
+	{
+		ParallelForWithTaskContext(TaskMixedProperties, RowData.Num() - 1, [&CompareRow, &Properties, &ParallelPropertyIndices](TBitArray<>& MixedProperties, int32 Index)
+		{
+			if (MixedProperties.Num() == 0)
+			{
+				MixedProperties.Init(false, Properties.Num());
+			}
+			CompareRow(MixedProperties, ParallelPropertyIndices, Index + 1);
+		});
 	}
 
-	auto FinalName = SelectedName.IsValid() ? *SelectedName : NAME_None;
-	CurrentRow = MakeShareable(new FStructFromDataTable(DataTable.Get(), FinalName));
-	if (StructureDetailsView.IsValid())
+	TBitArray<> MixedProperties(false, Properties.Num());
+	for (const TBitArray<>& TaskResult : TaskMixedProperties)
 	{
-		StructureDetailsView->SetCustomName(FText::FromName(FinalName));
-		if (!FinalName.IsNone())
+		if (TaskResult.Num() == Properties.Num())
 		{
-			StructureDetailsView->SetStructureData(CurrentRow);
+			MixedProperties.CombineWithBitwiseOR(TaskResult, EBitwiseOperatorFlags::MaintainSize);
 		}
 	}
 
-	RowSelectedCallback.ExecuteIfBound(FinalName);
+	for (int32 RowIndex = 1; GameThreadPropertyIndices.Num() > 0 && RowIndex < RowData.Num(); ++RowIndex)
+	{
+		CompareRow(MixedProperties, GameThreadPropertyIndices, RowIndex);
+	}
+
+	for (TConstSetBitIterator<> It(MixedProperties); It; ++It)
+	{
+		MixedPropertyNames.Add(Properties[It.GetIndex()]->GetFName());
+	}
+}
+
+EVisibility SEasyRowEditor::GetMultipleRowsVisibility() const
+{
+	return BoundRowNames.Num() > 1 ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+FText SEasyRowEditor::GetMultipleRowsText() const
+{
+	return FText::Format(LOCTEXT("MultipleRowsText", "Editing {0} rows, {1} {1}|plural(one=field differs,other=fields differ)"),
+		FText::AsNumber(BoundRowNames.Num()), FText::AsNumber(MixedPropertyNames.Num()));
+}
+
+FText SEasyRowEditor::GetMultipleRowsToolTipText() const
+{
+	const UScriptStruct* RowStruct = GetScriptStruct();
+
+	TArray<FString> DisplayNames;
+	for (const FName PropertyName : MixedPropertyNames)
+	{
+		const FProperty* Property = RowStruct ? RowStruct->FindPropertyByName(PropertyName) : nullptr;
+		DisplayNames.Add(Property ? Property->GetDisplayNameText().ToString() : PropertyName.ToString());
+	}
+
+	return DisplayNames.Num() > 0
+		? FText::Format(LOCTEXT("MultipleRowsToolTip", "Fields with different values:\n{0}"), FText::FromString(FString::Join(DisplayNames, TEXT("\n"))))
+		: LOCTEXT("MultipleRowsSameToolTip", "Every field has the same value in the edited rows");
+}
+
+void SEasyRowEditor::HandleSelectedRowsChanged()
+{
+	const FName CurrentName = GetCurrentName();
+	if (CurrentName.IsNone() || !StructureDetailsView.IsValid())
+	{
+		return;
+	}
+
+	TArray<FName> RowNames;
+	GatherBoundRowNames(CurrentName, RowNames);
+	if (RowNames != BoundRowNames)
+	{
+		BindRows(CurrentName);
+	}
 }
 
 UScriptStruct* SEasyRowEditor::GetScriptStruct() const
@@ -209,9 +360,21 @@ FString SEasyRowEditor::GetStructureDisplayName() const
 		: LOCTEXT("Error_UnknownStruct", "Error: Unknown Struct").ToString();
 }
 
-TSharedRef<SWidget> SEasyRowEditor::OnGenerateWidget(TSharedPtr<FName> InItem)
+TSharedRef<SWidget> SEasyRowEditor::MakeRowPicker()
 {
-	return SNew(STextBlock).Text(FText::FromName(InItem.IsValid() ? *InItem : NAME_None));
+	TSharedRef<SEasyDataTableRowPicker> RowPicker = SNew(SEasyDataTableRowPicker)
+		.Model(Model)
+		.SelectedRowName(GetCurrentName())
+		.OnRowPicked(this, &SEasyRowEditor::OnRowPicked);
+
+	RowComboButton->SetMenuContentWidgetToFocus(RowPicker->GetWidgetToFocus());
+	return RowPicker;
+}
+
+void SEasyRowEditor::OnRowPicked(FName RowName)
+{
+	RowComboButton->SetIsOpen(false);
+	SelectRow(RowName);
 }
 
 void SEasyRowEditor::OnSelectionChanged(TSharedPtr<FName> InItem, ESelectInfo::Type InSeletionInfo)
@@ -228,24 +391,14 @@ void SEasyRowEditor::OnSelectionChanged(TSharedPtr<FName> InItem, ESelectInfo::T
 
 void SEasyRowEditor::SelectRow(FName InName)
 {
-	TSharedPtr<FName> NewSelectedName;
-	for (auto Name : CachedRowNames)
+	if (GetCurrentName() != InName || !SelectedName.IsValid())
 	{
-		if (Name.IsValid() && (*Name == InName))
-		{
-			NewSelectedName = Name;
-		}
+		OnSelectionChanged(MakeShareable(new FName(InName)), ESelectInfo::Direct);
 	}
-	if (!NewSelectedName.IsValid())
-	{
-		NewSelectedName = MakeShareable(new FName(InName));
-	}
-	OnSelectionChanged(NewSelectedName, ESelectInfo::Direct);
 }
 
 void SEasyRowEditor::HandleUndoRedo()
 {
-	RefreshNameList();
 	Restore();
 }
 
@@ -267,22 +420,27 @@ FReply SEasyRowEditor::OnAddClicked()
 
 FReply SEasyRowEditor::OnRemoveClicked()
 {
-	if (DataTable.IsValid())
+	if (DataTable.IsValid() && Model.IsValid())
 	{
 		const FName RowToRemove = GetCurrentName();
-		const int32 RowToRemoveIndex = CachedRowNames.IndexOfByPredicate([&](const TSharedPtr<FName>& InRowName) -> bool
+
+		// Try and keep the same row index selected, that is the next row or the previous one for the last row
+		FName RowToSelect = NAME_None;
+		Model->BuildIfNeeded();
+		const TArray<FEasyDataTableEditorRowListViewDataPtr>& Rows = Model->GetRows();
+		const int32 RowToRemoveIndex = Model->FindRowIndex(RowToRemove);
+		if (Rows.IsValidIndex(RowToRemoveIndex + 1))
 		{
-			return *InRowName == RowToRemove;
-		});
+			RowToSelect = Rows[RowToRemoveIndex + 1]->RowId;
+		}
+		else if (RowToRemoveIndex > 0)
+		{
+			RowToSelect = Rows[RowToRemoveIndex - 1]->RowId;
+		}
 
-		if (FEasyDataTableEditorUtils::RemoveRow(DataTable.Get(), RowToRemove))
+		if (FEasyDataTableEditorUtils::RemoveRow(DataTable.Get(), RowToRemove) && !RowToSelect.IsNone())
 		{
-			// Try and keep the same row index selected
-			const int32 RowIndexToSelect = FMath::Clamp(RowToRemoveIndex, 0, CachedRowNames.Num() - 1);
-			if (CachedRowNames.IsValidIndex(RowIndexToSelect))
-			{
-				SelectRow(*CachedRowNames[RowIndexToSelect]);
-			}
+			SelectRow(RowToSelect);
 		}
 	}
 	return FReply::Handled();
@@ -333,16 +491,13 @@ void SEasyRowEditor::OnRowRenamed(const FText& Text, ETextCommit::Type CommitTyp
 
 			return;
 		}
-		for (auto Name : CachedRowNames)
+		if (DataTable->GetRowMap().Contains(NewName))
 		{
-			if (Name.IsValid() && (*Name == NewName))
-			{
-				//the name already exists
-				// popup an error dialog here
-				const FText Message = FText::Format(LOCTEXT("DuplicateRowName", "'{0}' is already used as a row name in this table"), Text);
-				FMessageDialog::Open(EAppMsgType::Ok, Message);
-				return;
-			}
+			//the name already exists
+			// popup an error dialog here
+			const FText Message = FText::Format(LOCTEXT("DuplicateRowName", "'{0}' is already used as a row name in this table"), Text);
+			FMessageDialog::Open(EAppMsgType::Ok, Message);
+			return;
 		}
 
 		const FName OldName = GetCurrentName();
@@ -365,9 +520,14 @@ EVisibility SEasyRowEditor::GetResetToDefaultVisibility() const
 {
 	EVisibility VisibleState = EVisibility::Collapsed;
 
-	if (DataTable.IsValid() && SelectedName.IsValid())
+	// The comparison is cached by the model until the table changes again. A released cache is not rebuilt just
+	// for this, the row is compared directly instead
+	if (Model.IsValid() && SelectedName.IsValid())
 	{
-		if (FEasyDataTableEditorUtils::DiffersFromDefault(DataTable.Get(), *SelectedName.Get()))
+		const bool bDiffersFromDefault = Model->HasBuiltCache()
+			? Model->DoesRowDifferFromDefault(Model->FindRowIndex(*SelectedName))
+			: FEasyDataTableEditorUtils::DiffersFromDefault(DataTable.Get(), *SelectedName);
+		if (bDiffersFromDefault)
 		{
 			VisibleState = EVisibility::Visible;
 		}
@@ -385,6 +545,10 @@ void SEasyRowEditor::Construct(const FArguments& InArgs, UDataTable* Changed, TW
 void SEasyRowEditor::ConstructInternal(UDataTable* Changed)
 {
 	DataTable = Changed;
+	if (Changed)
+	{
+		Model = FEasyDataTableEditorModel::FindOrCreate(Changed);
+	}
 	{
 		FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 		FDetailsViewArgs ViewArgs;
@@ -402,7 +566,6 @@ void SEasyRowEditor::ConstructInternal(UDataTable* Changed)
 		StructureDetailsView = PropertyModule.CreateStructureDetailView(ViewArgs, StructureViewArgs, CurrentRow, LOCTEXT("RowValue", "Row Value"));
 	}
 
-	RefreshNameList();
 	Restore();
 	const float ButtonWidth = 85.0f;
 	ChildSlot
@@ -420,11 +583,9 @@ void SEasyRowEditor::ConstructInternal(UDataTable* Changed)
 				.WidthOverride(2 * ButtonWidth)
 				.ToolTipText(LOCTEXT("SelectedRowTooltip", "Select a row to edit"))
 				[
-					SAssignNew(RowComboBox, SComboBox<TSharedPtr<FName>>)
-					.OptionsSource(&CachedRowNames)
-					.OnSelectionChanged(this, &SEasyRowEditor::OnSelectionChanged)
-					.OnGenerateWidget(this, &SEasyRowEditor::OnGenerateWidget)
-					.Content()
+					SAssignNew(RowComboButton, SComboButton)
+					.OnGetMenuContent(this, &SEasyRowEditor::MakeRowPicker)
+					.ButtonContent()
 					[
 						SNew(STextBlock).Text(this, &SEasyRowEditor::GetCurrentNameAsText)
 					]
@@ -452,6 +613,15 @@ void SEasyRowEditor::ConstructInternal(UDataTable* Changed)
 
 		]
 		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4, 2)
+		[
+			SNew(STextBlock)
+			.Visibility(this, &SEasyRowEditor::GetMultipleRowsVisibility)
+			.Text(this, &SEasyRowEditor::GetMultipleRowsText)
+			.ToolTipText(this, &SEasyRowEditor::GetMultipleRowsToolTipText)
+		]
+		+ SVerticalBox::Slot()
 		[
 			StructureDetailsView->GetWidget().ToSharedRef()
 		]
@@ -2,12 +2,14 @@
 
 #include "Containers/Array.h"
 #include "Containers/BitArray.h"
+#include "Containers/Map.h"
 #include "Containers/Set.h"
 #include "Containers/SparseArray.h"
 #include "Containers/UnrealString.h"
 #include "EasyDataTableEditorUtils.h"
 #include "Delegates/Delegate.h"
 #include "HAL/PlatformCrt.h"
+#include "IStructureDataProvider.h"
 #include "Input/Reply.h"
 #include "Internationalization/Text.h"
 #include "Kismet2/StructureEditorUtils.h"
@@ -22,7 +24,7 @@
 #include "UObject/NameTypes.h"
 #include "UObject/SoftObjectPtr.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
-#include "Widgets/Input/SComboBox.h"
+#include "Widgets/Input/SComboButton.h"
 #include "Widgets/SCompoundWidget.h"
 
 class FProperty;
@@ -89,6 +91,40 @@ public:
 		return RowName;
 	}
 };
+
+/** Rows of a table bound together to a details view, which shows "Multiple Values" where they differ */
+class FEasyDataTableRowsStructureProvider : public IStructureDataProvider
+{
+public:
+	FEasyDataTableRowsStructureProvider(UDataTable* InDataTable, TArray<FName> InRowNames)
+		: DataTable(InDataTable)
+		, RowNames(MoveTemp(InRowNames))
+	{}
+
+	virtual bool IsValid() const override
+	{
+		return DataTable.IsValid() && DataTable->GetRowStruct() && RowNames.Num() > 0;
+	}
+
+	virtual const UStruct* GetBaseStructure() const override
+	{
+		return DataTable.IsValid() ? DataTable->GetRowStruct() : nullptr;
+	}
+
+	virtual void GetInstances(TArray<TSharedPtr<FStructOnScope>>& OutInstances, const UStruct* ExpectedBaseStructure) const override
+	{
+		OutInstances.Reserve(OutInstances.Num() + RowNames.Num());
+		for (const FName RowName : RowNames)
+		{
+			OutInstances.Add(MakeShared<FStructFromDataTable>(DataTable.Get(), RowName));
+		}
+	}
+
+private:
+	TWeakObjectPtr<UDataTable> DataTable;
+	TArray<FName> RowNames;
+};
+
 class SEasyRowEditor : public SCompoundWidget
 	, public FNotifyHook
 	, public FStructureEditorUtils::INotifyOnStructChanged
@@ -117,19 +153,42 @@ public:
 
 protected:
 friend FEasyDataTableEditorUtils;
-	TArray<TSharedPtr<FName>> CachedRowNames;
 	TSharedPtr<FStructOnScope> CurrentRow;
 	TSoftObjectPtr<UDataTable> DataTable; // weak obj ptr couldn't handle reimporting
 	TSharedPtr<class IStructureDetailsView> StructureDetailsView;
 	TSharedPtr<FName> SelectedName;
-	TSharedPtr<SComboBox<TSharedPtr<FName>>> RowComboBox;
+	TSharedPtr<SComboButton> RowComboButton;
+
+	/** Cached rows of the table, shared with the grid; the row picker lists them */
+	TSharedPtr<class FEasyDataTableEditorModel> Model;
 
 	TWeakPtr<class FEasyDataTableEditor> WeakEditor{nullptr};
 
-	void RefreshNameList();
+	/** Rows bound to the details view, the current row first; more than one while several rows are selected in the grid */
+	TArray<FName> BoundRowNames;
+
+	/** Top-level properties of the row struct whose value differs between the bound rows */
+	TArray<FName> MixedPropertyNames;
+
 	void CleanBeforeChange();
 	void Restore();
 
+	/** The current row, followed by the other rows selected in the grid if it is part of the selection */
+	void GatherBoundRowNames(FName CurrentName, TArray<FName>& OutRowNames) const;
+
+	/** Binds the rows from GatherBoundRowNames to the details view */
+	void BindRows(FName CurrentName);
+
+	/**
+	 * Compares the bound rows property by property, in parallel except for properties holding object references.
+	 * The result is kept until the rows or their data change.
+	 */
+	void UpdateMixedPropertyNames();
+
+	EVisibility GetMultipleRowsVisibility() const;
+	FText GetMultipleRowsText() const;
+	FText GetMultipleRowsToolTipText() const;
+
 	/** Functions for enabling, disabling, and hiding portions of the row editor */
 	virtual bool IsMoveRowUpEnabled() const;
 	virtual bool IsMoveRowDownEnabled() const;
@@ -142,7 +201,9 @@ friend FEasyDataTableEditorUtils;
 	FName GetCurrentName() const;
 	FText GetCurrentNameAsText() const;
 	FString GetStructureDisplayName() const;
-	TSharedRef<SWidget> OnGenerateWidget(TSharedPtr<FName> InItem);
+	/** Builds the row picker each time the drop-down opens */
+	TSharedRef<SWidget> MakeRowPicker();
+	void OnRowPicked(FName RowName);
 	virtual void OnSelectionChanged(TSharedPtr<FName> InItem, ESelectInfo::Type InSeletionInfo);
 	
 	virtual FReply OnAddClicked();
@@ -163,4 +224,7 @@ public:
 
 	void HandleUndoRedo();
 
+	/** Rebinds the details view when the set of rows selected in the grid changed */
+	void HandleSelectedRowsChanged();
+
 };